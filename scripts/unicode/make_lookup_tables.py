@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+
+# make_lookup_tables.py
+#
+# Copyright (c) 2021 Yuriy Lisovskiy
+#
+# Generates 'src/unicode/lookup_tables.h' from range tables
+# defined in 'src/unicode/tables.h'.
+#
+# Usage: python3 scripts/unicode/make_lookup_tables.py
+
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..')
+TABLES_PATH = os.path.join(ROOT, 'src', 'unicode', 'tables.h')
+OUTPUT_PATH = os.path.join(ROOT, 'src', 'unicode', 'lookup_tables.h')
+
+MAX_WCHAR_T = 0x10FFFF
+UPPER_LOWER = MAX_WCHAR_T + 1
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+FLAG_WHITE_SPACE = 1
+
+
+def _table_body(source, name):
+	match = re.search(name + r'\s*=\s*\{(.*?)\n\};', source, re.S)
+	if match is None:
+		raise RuntimeError('table is not found: ' + name)
+
+	return match.group(1).replace('UPPER_LOWER', str(UPPER_LOWER))
+
+
+def _numbers(text):
+	return [int(n, 0) for n in re.findall(r'(?<![\w.])-?(?:0x[0-9A-Fa-f]+|\d+)', re.sub(r'//.*', '', text))]
+
+
+def _groups(values, size):
+	return [values[i:i + size] for i in range(0, len(values), size)]
+
+
+def load_tables():
+	with open(TABLES_PATH) as f:
+		source = f.read()
+
+	white_space = _groups(_numbers(_table_body(source, 'WHITE_SPACE').split('.latin_offset')[0]), 3)
+	ascii_fold = _numbers(_table_body(source, 'ASCII_FOLD'))
+	case_orbit = dict(_groups(_numbers(_table_body(source, 'CASE_ORBIT')), 2))
+	case_ranges = _groups(_numbers(_table_body(source, 'CASE_RANGES')), 5)
+	return white_space, ascii_fold, case_orbit, case_ranges
+
+
+def to_case(case_ranges, case, c):
+	for lo, hi, *delta in case_ranges:
+		if lo <= c <= hi:
+			d = delta[case]
+			if d > MAX_WCHAR_T:
+				return lo + (((c - lo) & ~1) | (case & 1))
+
+			return c + d
+
+	return c
+
+
+def build_records():
+	white_space, ascii_fold, case_orbit, case_ranges = load_tables()
+	upper, lower, title = {}, {}, {}
+	for lo, hi, *_ in case_ranges:
+		for c in range(lo, hi + 1):
+			upper[c] = to_case(case_ranges, 0, c)
+			lower[c] = to_case(case_ranges, 1, c)
+			title[c] = to_case(case_ranges, 2, c)
+
+	spaces = set()
+	for lo, hi, stride in white_space:
+		spaces.update(range(lo, hi + 1, stride))
+
+	def simple_fold(c):
+		if c < len(ascii_fold):
+			return ascii_fold[c]
+
+		if c in case_orbit:
+			return case_orbit[c]
+
+		l = lower.get(c, c)
+		return l if l != c else upper.get(c, c)
+
+	interesting = set(upper) | spaces | set(case_orbit) | set(range(len(ascii_fold)))
+	records = [(0, 0, 0, 0, 0)]
+	record_index = {records[0]: 0}
+	values = {}
+	for c in sorted(interesting):
+		record = (
+			upper.get(c, c) - c,
+			lower.get(c, c) - c,
+			title.get(c, c) - c,
+			simple_fold(c) - c,
+			FLAG_WHITE_SPACE if c in spaces else 0
+		)
+		if record not in record_index:
+			record_index[record] = len(records)
+			records.append(record)
+
+		values[c] = record_index[record]
+
+	last = max(values)
+	stage1, stage2, block_index = [], [], {}
+	for block_start in range(0, last + 1, BLOCK_SIZE):
+		block = tuple(values.get(c, 0) for c in range(block_start, block_start + BLOCK_SIZE))
+		if block not in block_index:
+			block_index[block] = len(block_index)
+			stage2.extend(block)
+
+		stage1.append(block_index[block])
+
+	return records, stage1, stage2
+
+
+def _format_array(values, per_line=16):
+	lines = []
+	for chunk in _groups(values, per_line):
+		lines.append('\t' + ', '.join(str(v) for v in chunk) + ',')
+
+	return '\n'.join(lines)
+
+
+def main():
+	records, stage1, stage2 = build_records()
+	stage1_type = 'uint8_t' if max(stage1) < 256 else 'uint16_t'
+	stage2_type = 'uint8_t' if len(records) < 256 else 'uint16_t'
+	record_lines = '\n'.join(
+		'\t{%d, %d, %d, %d, %d},' % record for record in records
+	)
+	with open(OUTPUT_PATH, 'w') as f:
+		f.write(f'''/**
+ * unicode/lookup_tables.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Two-level lookup tables for white space, case mapping and case folding.
+ *
+ * DO NOT EDIT: generated by 'scripts/unicode/make_lookup_tables.py'
+ * from range tables in 'unicode/tables.h'.
+ */
+
+#pragma once
+
+// Module definitions.
+#include "./_def_.h"
+
+
+__UNICODE_BEGIN__
+
+// Properties of a code point, all mappings are stored as deltas.
+struct CharRecord
+{{
+	int32_t upper;
+	int32_t lower;
+	int32_t title;
+	int32_t fold;
+	uint8_t flags;
+}};
+
+inline constexpr const uint8_t CHAR_FLAG_WHITE_SPACE = {FLAG_WHITE_SPACE};
+
+inline constexpr const uint32_t LOOKUP_BLOCK_SHIFT = {BLOCK_SHIFT};
+
+// The first code point which is not covered by the lookup tables, all
+// code points starting from it have default record.
+inline constexpr const uint32_t LOOKUP_MAX = {len(stage1) << BLOCK_SHIFT};
+
+inline constexpr const CharRecord CHAR_RECORDS[{len(records)}] = {{
+{record_lines}
+}};
+
+// Maps 'c >> LOOKUP_BLOCK_SHIFT' to index of block in 'LOOKUP_STAGE_2'.
+inline constexpr const {stage1_type} LOOKUP_STAGE_1[{len(stage1)}] = {{
+{_format_array(stage1)}
+}};
+
+// Blocks of indices in 'CHAR_RECORDS'.
+inline constexpr const {stage2_type} LOOKUP_STAGE_2[{len(stage2)}] = {{
+{_format_array(stage2)}
+}};
+
+__UNICODE_END__
+''')
+
+
+if __name__ == '__main__':
+	main()
@@ -21,6 +21,7 @@
 #endif
 
 // Base libraries.
+#include "./datetime_format.h"
 #include "./sys.h"
 
 
@@ -87,7 +88,7 @@ size_t _ymd2ord(ushort year, ushort month, ushort day)
 		day >= 1 && day <= dim,
 		(std::string("day must be in 1..") + std::to_string(dim)).c_str()
 	);
-	return _days_before_year(year) + _days_before_month(year, month) + day;
+	return (size_t)(_days_from_civil(year, month, day) + _UNIX_EPOCH_ORDINAL);
 }
 
 ymd _ord2ymd(size_t n)
@@ -978,9 +979,13 @@ Date Date::from_ordinal(size_t n)
 
 Date Date::from_iso_format(const std::string& date_str)
 {
-	m_assert(date_str.size() == 10, ("Date: invalid iso format string: " + date_str).c_str());
-	auto iso_ymd = _parse_isoformat_date(date_str);
-	return Date(iso_ymd.year, iso_ymd.month, iso_ymd.day);
+	DatetimeFields fields;
+	if (!parse_iso_date(date_str, fields))
+	{
+		throw std::invalid_argument("Date: invalid iso format string: " + date_str);
+	}
+
+	return Date(fields.year, fields.month, fields.day);
 }
 
 Date Date::from_iso_calendar(ushort year, ushort week, ushort day)
@@ -1050,7 +1055,8 @@ std::string Date::strftime(const std::string& fmt) const
 
 std::string Date::iso_format() const
 {
-	return _lf(this->_year, 4) + "-" + _lf(this->_month) + "-" + _lf(this->_day);
+	char buffer[ISO_DATE_SIZE];
+	return {buffer, format_iso_date(buffer, *this)};
 }
 
 std::string Date::str() const
@@ -1354,16 +1360,8 @@ std::string Time::_tz_str() const
 
 std::string Time::iso_format(time_spec ts) const
 {
-	auto s = _format_time(
-		this->_hour, this->_minute, this->_second, this->_microsecond, ts
-	);
-	auto tz = this->_tz_str();
-	if (!tz.empty())
-	{
-		s += tz;
-	}
-
-	return s;
+	char buffer[ISO_TIME_MAX_SIZE];
+	return {buffer, format_iso_time(buffer, *this, ts)};
 }
 
 std::string Time::str() const
@@ -1373,8 +1371,15 @@ std::string Time::str() const
 
 Time Time::from_iso_format(const std::string& time_str)
 {
-	auto t = _parse_isoformat_time(time_str);
-	return Time(t.hh, t.mm, t.ss, t.ff, t.tz);
+	DatetimeFields fields;
+	if (!parse_iso_time(time_str, fields))
+	{
+		throw std::invalid_argument("Time: invalid iso format string: " + time_str);
+	}
+
+	return Time(
+		fields.hour, fields.minute, fields.second, fields.microsecond, _timezone_from_offset(fields)
+	);
 }
 
 std::string Time::strftime(const std::string& fmt) const
@@ -1790,24 +1795,16 @@ Datetime Datetime::combine(
 
 Datetime Datetime::from_iso_format(const std::string& date_str)
 {
-	// Split this at the separator
-	auto d_str = date_str.substr(0, 10);
-	auto t_str = date_str.substr(11);
-
-	auto date_comps = _parse_isoformat_date(d_str);
-	hmsfz time_comps;
-	if (!t_str.empty())
+	DatetimeFields fields;
+	if (!parse_iso_datetime(date_str, fields))
 	{
-		time_comps = _parse_isoformat_time(t_str);
-	}
-	else
-	{
-		time_comps = {0, 0, 0, 0, nullptr};
+		throw std::invalid_argument("Datetime: invalid iso format string: " + date_str);
 	}
 
 	return Datetime(
-		date_comps.year, date_comps.month, date_comps.day,
-		time_comps.hh, time_comps.mm, time_comps.ss, time_comps.ff, time_comps.tz
+		fields.year, fields.month, fields.day,
+		fields.hour, fields.minute, fields.second, fields.microsecond,
+		_timezone_from_offset(fields)
 	);
 }
 
@@ -2010,21 +2007,8 @@ std::string Datetime::ctime() const
 
 std::string Datetime::iso_format(char sep, time_spec ts) const
 {
-	auto s = _lf(this->_year, 4) + "-" +
-		_lf(this->_month) + "-" +
-		_lf(this->_day) + sep +
-		_format_time(
-			this->_hour, this->_minute,
-			this->_second, this->_microsecond, ts
-		);
-	auto off = this->utc_offset();
-	auto tz = _format_offset(off.get());
-	if (!tz.empty())
-	{
-		s += tz;
-	}
-
-	return s;
+	char buffer[ISO_DATETIME_MAX_SIZE];
+	return {buffer, format_iso_datetime(buffer, *this, sep, ts)};
 }
 
 std::string Datetime::str() const
@@ -2357,14 +2341,19 @@ Timezone& Timezone::operator = (const Timezone& other)
 	return *this;
 }
 
-bool Timezone::operator == (const Timezone& other) const
+bool Timezone::_equals(const Timezone& other) const
 {
 	return *this->_offset == *other._offset;
 }
 
+bool Timezone::operator == (const Timezone& other) const
+{
+	return this->_equals(other) && other._equals(*this);
+}
+
 bool Timezone::operator != (const Timezone& other) const
 {
-	return *this->_offset != *other._offset;
+	return !(*this == other);
 }
 
 std::string Timezone::str() const
@@ -2567,6 +2556,21 @@ size_t _iso_week1monday(ushort year)
 	return week1monday;
 }
 
+std::shared_ptr<Timezone> _timezone_from_offset(const DatetimeFields& fields)
+{
+	if (!fields.has_utc_offset)
+	{
+		return nullptr;
+	}
+
+	if (fields.utc_offset_seconds == 0 && fields.utc_offset_microseconds == 0)
+	{
+		return Timezone::UTC.ptr_copy();
+	}
+
+	return Timezone(Timedelta(0, fields.utc_offset_seconds, fields.utc_offset_microseconds)).ptr_copy();
+}
+
 hmsfz _parse_isoformat_time(const std::string& t_str)
 {
 	// Format supported is HH[:MM[:SS[.fff[fff]]]][+HH:MM[:SS[.ffffff]]]
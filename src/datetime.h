@@ -120,6 +120,13 @@ T1 _mod(const T1& a, const T2& b)
 	return (b + (a % b)) % b;
 }
 
+// Division rounded towards negative infinity.
+template <typename T1, typename T2>
+T1 _floor_div(const T1& a, const T2& b)
+{
+	return a / b - (a % b != 0 && (a < 0) != (b < 0));
+}
+
 long _true_div(const long& x, const long& y);
 
 std::pair<long long, long long> _div_mod(const long long& x, const long long& y);
@@ -827,6 +834,12 @@ private:
 private:
 	Timezone() = default;
 
+protected:
+	// Returns `true` if `other` has the same rules. Time zones are
+	// equal if both of them agree, so derived classes with rules that
+	// are not a fixed offset must override it.
+	[[nodiscard]] virtual bool _equals(const Timezone& other) const;
+
 public:
 	const static Timezone UTC;
 
@@ -858,6 +871,10 @@ public:
 	//  }
 	[[nodiscard]] virtual std::shared_ptr<Timezone> ptr_copy() const;
 
+	Timezone(const Timezone& other) = default;
+
+	virtual ~Timezone() = default;
+
 	Timezone& operator = (const Timezone& other);
 
 	bool operator == (const Timezone& other) const;
@@ -908,6 +925,12 @@ struct hmsfz : public hmsf
 
 extern hmsfz _parse_isoformat_time(const std::string& t_str);
 
+struct DatetimeFields;
+
+// Returns time zone with UTC offset from `fields`, `Timezone::UTC` if the
+// offset is zero or `nullptr` if there is no offset.
+extern std::shared_ptr<Timezone> _timezone_from_offset(const DatetimeFields& fields);
+
 extern Datetime _strptime_datetime(
 	const std::string& datetime_str,
 	const char* format = "%a %b %d %H:%M:%S %Y"
@@ -0,0 +1,118 @@
+/**
+ * datetime_clock.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./datetime_clock.h"
+
+// C++ libraries.
+#include <chrono>
+
+// Base libraries.
+#include "./sys.h"
+
+#if defined(__unix__) || defined(__linux__) || defined(__mac__)
+#include <time.h>
+#define _XW_HAS_CLOCK_GETTIME
+#endif
+
+
+__DATETIME_BEGIN__
+
+#ifdef _XW_HAS_CLOCK_GETTIME
+static inline int64_t _clock_ns(clockid_t clock)
+{
+	struct timespec value{};
+	clock_gettime(clock, &value);
+	return (int64_t)value.tv_sec * 1000000000 + value.tv_nsec;
+}
+#endif
+
+int64_t now_monotonic_ns()
+{
+#ifdef _XW_HAS_CLOCK_GETTIME
+	return _clock_ns(CLOCK_MONOTONIC);
+#else
+	auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+#endif
+}
+
+int64_t now_monotonic_coarse_ns()
+{
+#ifdef CLOCK_MONOTONIC_COARSE
+	return _clock_ns(CLOCK_MONOTONIC_COARSE);
+#else
+	return now_monotonic_ns();
+#endif
+}
+
+int64_t now_realtime_ns()
+{
+#ifdef _XW_HAS_CLOCK_GETTIME
+	return _clock_ns(CLOCK_REALTIME);
+#else
+	auto now = std::chrono::system_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+#endif
+}
+
+CompactDatetime now_coarse()
+{
+#ifdef CLOCK_REALTIME_COARSE
+	auto nanoseconds = _clock_ns(CLOCK_REALTIME_COARSE);
+#else
+	auto nanoseconds = now_realtime_ns();
+#endif
+	return CompactDatetime(nanoseconds / 1000, 0);
+}
+
+Timedelta timedelta_from_ns(int64_t nanoseconds)
+{
+	return Timedelta(0, (long)(nanoseconds / 1000000000), (long)(nanoseconds % 1000000000 / 1000));
+}
+
+#if defined(__aarch64__)
+static double _cycle_clock_frequency()
+{
+	uint64_t value;
+	asm volatile("mrs %0, cntfrq_el0" : "=r"(value));
+	return (double)value;
+}
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+static double _cycle_clock_frequency()
+{
+	// Busy wait instead of sleeping, so the thread is less likely to be
+	// moved to another core in the middle of the measurement.
+	const int64_t duration = 5000000;
+	auto start_ns = now_monotonic_ns();
+	auto start_ticks = CycleClock::now();
+	int64_t elapsed_ns;
+	do
+	{
+		elapsed_ns = now_monotonic_ns() - start_ns;
+	}
+	while (elapsed_ns < duration);
+
+	return (double)(CycleClock::now() - start_ticks) * 1e9 / (double)elapsed_ns;
+}
+#else
+static double _cycle_clock_frequency()
+{
+	return 1e9;
+}
+#endif
+
+double CycleClock::frequency()
+{
+	static const double frequency = _cycle_clock_frequency();
+	return frequency;
+}
+
+int64_t CycleClock::to_nanoseconds(uint64_t ticks)
+{
+	return (int64_t)((double)ticks * 1e9 / CycleClock::frequency());
+}
+
+__DATETIME_END__
@@ -0,0 +1,88 @@
+/**
+ * datetime_clock.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Clock sources for timestamps and measuring intervals.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./datetime.h"
+#include "./datetime_compact.h"
+
+
+__DATETIME_BEGIN__
+
+// Returns nanoseconds of monotonic clock, which is not affected by
+// changes of the system time. The starting point is unspecified.
+extern int64_t now_monotonic_ns();
+
+// Same as above with resolution of the kernel tick, usually 1-4 ms.
+// Falls back to `now_monotonic_ns` if coarse clock is not available.
+extern int64_t now_monotonic_coarse_ns();
+
+// Returns nanoseconds since 1970-01-01T00:00:00 UTC of the system
+// clock.
+extern int64_t now_realtime_ns();
+
+// Returns current UTC time with resolution of the kernel tick. Much
+// cheaper than `Datetime::now` and `now_realtime_ns` where coarse clock
+// is available.
+extern CompactDatetime now_coarse();
+
+// Converts nanoseconds to `Timedelta`, truncating to microseconds.
+extern Timedelta timedelta_from_ns(int64_t nanoseconds);
+
+// Processor cycle counter for instrumentation: time stamp counter on
+// x86, virtual counter on ARM64 and monotonic clock elsewhere. Reading
+// it does not enter the kernel.
+//
+// Frequency is calibrated once against monotonic clock on the first
+// conversion, which takes a few milliseconds. Values are meant for
+// measuring short intervals and assume constant rate counter, which
+// all modern processors provide.
+class CycleClock final
+{
+public:
+	CycleClock() = delete;
+
+	// Returns current value of the counter.
+	static inline uint64_t now()
+	{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+		return __rdtsc();
+#elif defined(__aarch64__)
+		uint64_t value;
+		asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+		return value;
+#else
+		return (uint64_t)now_monotonic_ns();
+#endif
+	}
+
+	// Returns counter ticks per second.
+	static double frequency();
+
+	static int64_t to_nanoseconds(uint64_t ticks);
+
+	static inline Timedelta to_timedelta(uint64_t ticks)
+	{
+		return timedelta_from_ns(CycleClock::to_nanoseconds(ticks));
+	}
+};
+
+__DATETIME_END__
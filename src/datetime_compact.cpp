@@ -0,0 +1,141 @@
+/**
+ * datetime_compact.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./datetime_compact.h"
+
+// C++ libraries.
+#include <chrono>
+#include <stdexcept>
+
+
+__DATETIME_BEGIN__
+
+static const int64_t _MICROSECONDS_PER_SECOND = 1000000;
+static const int64_t _MICROSECONDS_PER_DAY = 86400 * _MICROSECONDS_PER_SECOND;
+
+static inline int32_t _checked_utc_offset(long seconds, long microseconds)
+{
+	if (microseconds)
+	{
+		throw std::invalid_argument("dt: UTC offset with microseconds is not supported by CompactDatetime");
+	}
+
+	if (seconds <= -86400 || seconds >= 86400)
+	{
+		throw std::invalid_argument("dt: UTC offset must be strictly between -24 and 24 hours");
+	}
+
+	return (int32_t)seconds;
+}
+
+CompactDatetime CompactDatetime::from_fields(const DatetimeFields& fields)
+{
+	auto utc_offset = NAIVE;
+	if (fields.has_utc_offset)
+	{
+		utc_offset = _checked_utc_offset(fields.utc_offset_seconds, fields.utc_offset_microseconds);
+	}
+
+	int64_t seconds = fields.hour * 3600 + fields.minute * 60 + fields.second;
+	if (utc_offset != NAIVE)
+	{
+		seconds -= utc_offset;
+	}
+
+	return CompactDatetime(
+		_days_from_civil(fields.year, fields.month, fields.day) * _MICROSECONDS_PER_DAY +
+			seconds * _MICROSECONDS_PER_SECOND + fields.microsecond,
+		utc_offset
+	);
+}
+
+CompactDatetime CompactDatetime::from_datetime(const Datetime& datetime)
+{
+	DatetimeFields fields;
+	fields.year = datetime.year();
+	fields.month = datetime.month();
+	fields.day = datetime.day();
+	fields.hour = datetime.hour();
+	fields.minute = datetime.minute();
+	fields.second = datetime.second();
+	fields.microsecond = (int)datetime.microsecond();
+	if (datetime.tz_info())
+	{
+		if (auto offset = datetime.utc_offset())
+		{
+			fields.has_utc_offset = true;
+			fields.utc_offset_seconds = (int)(offset->days() * 86400 + offset->seconds());
+			fields.utc_offset_microseconds = (int)offset->microseconds();
+		}
+	}
+
+	return CompactDatetime::from_fields(fields);
+}
+
+CompactDatetime CompactDatetime::utc_now()
+{
+	auto now = std::chrono::system_clock::now().time_since_epoch();
+	return CompactDatetime(std::chrono::duration_cast<std::chrono::microseconds>(now).count(), 0);
+}
+
+bool CompactDatetime::parse_iso(std::string_view s, CompactDatetime& result)
+{
+	DatetimeFields fields;
+	if (!parse_iso_datetime(s, fields) || fields.utc_offset_microseconds ||
+		fields.utc_offset_seconds <= -86400 || fields.utc_offset_seconds >= 86400)
+	{
+		return false;
+	}
+
+	result = CompactDatetime::from_fields(fields);
+	return true;
+}
+
+DatetimeFields CompactDatetime::fields() const
+{
+	auto local = this->_microseconds + (int64_t)this->utc_offset() * _MICROSECONDS_PER_SECOND;
+	auto days = local / _MICROSECONDS_PER_DAY;
+	auto remainder = local % _MICROSECONDS_PER_DAY;
+	if (remainder < 0)
+	{
+		days--;
+		remainder += _MICROSECONDS_PER_DAY;
+	}
+
+	DatetimeFields fields;
+	_civil_from_days((long)days, fields);
+	auto seconds = (int)(remainder / _MICROSECONDS_PER_SECOND);
+	fields.hour = seconds / 3600;
+	fields.minute = seconds / 60 % 60;
+	fields.second = seconds % 60;
+	fields.microsecond = (int)(remainder % _MICROSECONDS_PER_SECOND);
+	fields.has_utc_offset = !this->is_naive();
+	fields.utc_offset_seconds = this->utc_offset();
+	return fields;
+}
+
+Datetime CompactDatetime::to_datetime() const
+{
+	auto fields = this->fields();
+	return Datetime(
+		fields.year, fields.month, fields.day,
+		fields.hour, fields.minute, fields.second, fields.microsecond,
+		_timezone_from_offset(fields)
+	);
+}
+
+size_t CompactDatetime::format_iso(char* buffer, char sep, time_spec ts) const
+{
+	return format_iso_datetime(buffer, this->fields(), sep, ts);
+}
+
+std::string CompactDatetime::iso_format(char sep, time_spec ts) const
+{
+	char buffer[ISO_DATETIME_MAX_SIZE];
+	return {buffer, this->format_iso(buffer, sep, ts)};
+}
+
+__DATETIME_END__
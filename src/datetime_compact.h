@@ -0,0 +1,173 @@
+/**
+ * datetime_compact.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Compact value type for date and time.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./datetime_format.h"
+
+
+__DATETIME_BEGIN__
+
+// Date and time as microseconds since 1970-01-01T00:00:00 UTC and fixed
+// UTC offset in seconds. It takes 16 bytes, has no time zone object and
+// is trivially copyable, so large arrays of values can be stored, copied
+// and sorted without reference counting and heap allocations.
+//
+// Naive value stores its wall time as if it was UTC.
+//
+// Values are ordered by the instant first and by the offset next, so
+// two values are equal only if both the instant and the offset are
+// equal. Naive values are ordered as UTC ones.
+class CompactDatetime final
+{
+public:
+	// Offset of naive value.
+	static constexpr int32_t NAIVE = std::numeric_limits<int32_t>::min();
+
+private:
+	int64_t _microseconds = 0;
+	int32_t _utc_offset = NAIVE;
+
+public:
+	// Naive 1970-01-01T00:00:00.
+	constexpr CompactDatetime() = default;
+
+	// `microseconds` since epoch and `utc_offset` in seconds, naive by
+	// default.
+	constexpr explicit CompactDatetime(int64_t microseconds, int32_t utc_offset=NAIVE)
+		: _microseconds(microseconds), _utc_offset(utc_offset)
+	{
+	}
+
+	// Converts broken-down local time. Ranges are not checked.
+	//
+	// Throws `std::invalid_argument` if UTC offset has microseconds.
+	static CompactDatetime from_fields(const DatetimeFields& fields);
+
+	// Converts `datetime` with the UTC offset at that moment.
+	//
+	// Throws `std::invalid_argument` if UTC offset has microseconds.
+	static CompactDatetime from_datetime(const Datetime& datetime);
+
+	// Current UTC time.
+	static CompactDatetime utc_now();
+
+	// Parses the result of `Datetime::iso_format` or `format_iso`.
+	//
+	// Returns `false` if the syntax or UTC offset is invalid. Ranges
+	// are not checked.
+	static bool parse_iso(std::string_view s, CompactDatetime& result);
+
+	// Returns microseconds since 1970-01-01T00:00:00 UTC, or since
+	// the same wall time if the value is naive.
+	[[nodiscard]]
+	constexpr int64_t microseconds() const
+	{
+		return this->_microseconds;
+	}
+
+	[[nodiscard]]
+	constexpr bool is_naive() const
+	{
+		return this->_utc_offset == NAIVE;
+	}
+
+	// Returns UTC offset in seconds, zero if the value is naive.
+	[[nodiscard]]
+	constexpr int32_t utc_offset() const
+	{
+		return this->is_naive() ? 0 : this->_utc_offset;
+	}
+
+	// Returns the same instant with given UTC offset in seconds.
+	[[nodiscard]]
+	constexpr CompactDatetime with_utc_offset(int32_t utc_offset) const
+	{
+		return CompactDatetime(this->_microseconds, utc_offset);
+	}
+
+	// Returns broken-down local time.
+	[[nodiscard]]
+	DatetimeFields fields() const;
+
+	// Returns `Datetime` with fixed offset `Timezone`, or naive one.
+	[[nodiscard]]
+	Datetime to_datetime() const;
+
+	// Writes the value in the format of `Datetime::iso_format` into
+	// `buffer` of at least `ISO_DATETIME_MAX_SIZE` bytes.
+	//
+	// Returns the number of written characters.
+	size_t format_iso(char* buffer, char sep='T', time_spec ts=time_spec::AUTO) const;
+
+	[[nodiscard]]
+	std::string iso_format(char sep='T', time_spec ts=time_spec::AUTO) const;
+
+	constexpr CompactDatetime operator + (int64_t microseconds) const
+	{
+		return CompactDatetime(this->_microseconds + microseconds, this->_utc_offset);
+	}
+
+	constexpr CompactDatetime operator - (int64_t microseconds) const
+	{
+		return CompactDatetime(this->_microseconds - microseconds, this->_utc_offset);
+	}
+
+	// Returns the difference between instants in microseconds.
+	constexpr int64_t operator - (const CompactDatetime& other) const
+	{
+		return this->_microseconds - other._microseconds;
+	}
+
+	constexpr bool operator == (const CompactDatetime& other) const
+	{
+		return this->_microseconds == other._microseconds && this->_utc_offset == other._utc_offset;
+	}
+
+	constexpr bool operator != (const CompactDatetime& other) const
+	{
+		return !(*this == other);
+	}
+
+	constexpr bool operator < (const CompactDatetime& other) const
+	{
+		return this->_microseconds < other._microseconds ||
+			(this->_microseconds == other._microseconds && this->_utc_offset < other._utc_offset);
+	}
+
+	constexpr bool operator > (const CompactDatetime& other) const
+	{
+		return other < *this;
+	}
+
+	constexpr bool operator <= (const CompactDatetime& other) const
+	{
+		return !(other < *this);
+	}
+
+	constexpr bool operator >= (const CompactDatetime& other) const
+	{
+		return !(*this < other);
+	}
+};
+
+static_assert(std::is_trivially_copyable_v<CompactDatetime>);
+static_assert(sizeof(CompactDatetime) == 16);
+
+__DATETIME_END__
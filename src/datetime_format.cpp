@@ -0,0 +1,977 @@
+/**
+ * datetime_format.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./datetime_format.h"
+
+// C++ libraries.
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+__DATETIME_BEGIN__
+
+static const char _DIGITS[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+// Indexed by weekday, where Monday == 0 ... Sunday == 6.
+static const std::string_view _WEEKDAY_NAMES[7] = {
+	"Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"
+};
+
+// Indexed by month, where January == 0.
+static const std::string_view _MONTH_FULL_NAMES[_MONTHS_COUNT] = {
+	"January", "February", "March", "April", "May", "June",
+	"July", "August", "September", "October", "November", "December"
+};
+
+// Maximum size of a rendered number: sign and digits of 'long'.
+static const size_t _MAX_NUMBER_SIZE = 20;
+
+void _write_2_digits(char* buffer, unsigned int value)
+{
+	std::memcpy(buffer, _DIGITS + value * 2, 2);
+}
+
+// Writes `value` padded with `pad` to `width` characters, or without
+// padding if `pad` is '\0'.
+//
+// Returns the pointer past the written characters.
+static inline char* _write_number(char* out, long value, int width, char pad)
+{
+	if (width == 2 && pad == '0' && value >= 0 && value < 100)
+	{
+		_write_2_digits(out, (unsigned int)value);
+		return out + 2;
+	}
+
+	char digits[_MAX_NUMBER_SIZE];
+	auto end = digits + _MAX_NUMBER_SIZE;
+	auto begin = end;
+	auto is_negative = value < 0;
+	unsigned long rest = is_negative ? 0ul - (unsigned long)value : (unsigned long)value;
+	do
+	{
+		*--begin = (char)('0' + rest % 10);
+		rest /= 10;
+	}
+	while (rest);
+
+	if (is_negative)
+	{
+		*--begin = '-';
+	}
+
+	if (pad)
+	{
+		for (auto size = end - begin; size < width; size++)
+		{
+			*out++ = pad;
+		}
+	}
+
+	std::memcpy(out, begin, end - begin);
+	return out + (end - begin);
+}
+
+static inline char* _write_text(char* out, std::string_view text, size_t width=0, char pad=' ')
+{
+	for (auto size = text.size(); size < width; size++)
+	{
+		*out++ = pad;
+	}
+
+	std::memcpy(out, text.data(), text.size());
+	return out + text.size();
+}
+
+// Proleptic Gregorian ordinal, considering 01-Jan-0001 as day 1. Unlike
+// `_ymd2ord`, it does not check the values.
+static inline long _ordinal(long year, int month, int day)
+{
+	if (month < 1 || month > _MONTHS_COUNT)
+	{
+		month = 1;
+	}
+
+	return _days_from_civil(year, month, day) + _UNIX_EPOCH_ORDINAL;
+}
+
+// Returns ordinal of the Monday starting ISO week 1 of `year`.
+static inline long _iso_week1monday_ordinal(long year)
+{
+	auto first_day = _ordinal(year, 1, 1);
+	auto first_weekday = _mod(first_day + 6, 7L);
+	auto week1monday = first_day - first_weekday;
+	if (first_weekday > 3)
+	{
+		week1monday += 7;
+	}
+
+	return week1monday;
+}
+
+struct _DateInfo
+{
+	// Monday == 0 ... Sunday == 6.
+	int weekday;
+
+	// January 1 == 0.
+	int year_day;
+
+	long iso_year;
+	int iso_week;
+};
+
+static inline _DateInfo _date_info(const Formatter::Fields& fields)
+{
+	_DateInfo info{};
+	auto ordinal = _ordinal(fields.year, fields.month, fields.day);
+	info.weekday = (int)_mod(ordinal + 6, 7L);
+	info.year_day = (int)(ordinal - _ordinal(fields.year, 1, 1));
+
+	info.iso_year = fields.year;
+	auto week1monday = _iso_week1monday_ordinal(info.iso_year);
+	if (ordinal < week1monday)
+	{
+		week1monday = _iso_week1monday_ordinal(--info.iso_year);
+	}
+	else
+	{
+		auto next_week1monday = _iso_week1monday_ordinal(info.iso_year + 1);
+		if (ordinal >= next_week1monday)
+		{
+			info.iso_year++;
+			week1monday = next_week1monday;
+		}
+	}
+
+	info.iso_week = (int)((ordinal - week1monday) / 7 + 1);
+	return info;
+}
+
+void Formatter::_append_literal(const char* data, size_t size)
+{
+	if (!this->_program.empty() && this->_program.back().op == Op::Literal)
+	{
+		this->_program.back().size += size;
+	}
+	else
+	{
+		this->_program.push_back({Op::Literal, '\0', 0, (unsigned int)this->_literals.size(), (unsigned int)size});
+	}
+
+	this->_literals.append(data, size);
+	this->_max_size += size;
+}
+
+void Formatter::_append(Op op, char pad, unsigned char width)
+{
+	this->_program.push_back({op, pad, width, 0, 0});
+	switch (op)
+	{
+		case Op::WeekdayFull:
+		case Op::MonthFull:
+			this->_max_size += std::max<size_t>(9, width);
+			break;
+		case Op::WeekdayShort:
+		case Op::MonthShort:
+			this->_max_size += std::max<size_t>(3, width);
+			break;
+		case Op::AmPm:
+		case Op::AmPmLower:
+			this->_max_size += std::max<size_t>(2, width);
+			break;
+		case Op::UtcOffset:
+			this->_uses_utc_offset = true;
+			this->_max_size += 1 + _MAX_NUMBER_SIZE + 4 + 1 + 6;
+			break;
+		case Op::TzName:
+			this->_tz_names_count++;
+			break;
+		default:
+			this->_max_size += std::max<size_t>(_MAX_NUMBER_SIZE, width);
+			break;
+	}
+}
+
+void Formatter::_compile(std::string_view format, bool nested)
+{
+	size_t i = 0;
+	auto size = format.size();
+	while (i < size)
+	{
+		auto percent = format.find('%', i);
+		if (percent == std::string_view::npos)
+		{
+			percent = size;
+		}
+
+		if (percent > i)
+		{
+			this->_append_literal(format.data() + i, percent - i);
+		}
+
+		if (percent == size)
+		{
+			break;
+		}
+
+		// Flag, width, then optional modifier, then conversion.
+		auto j = percent + 1;
+		char flag = '\0';
+		if (!nested && j < size && (format[j] == '-' || format[j] == '_' || format[j] == '0'))
+		{
+			flag = format[j++];
+		}
+
+		unsigned int width = 0;
+		while (!nested && j < size && format[j] >= '0' && format[j] <= '9' && width < 100)
+		{
+			width = width * 10 + format[j++] - '0';
+		}
+
+		if (j < size && (format[j] == 'E' || format[j] == 'O'))
+		{
+			j++;
+		}
+
+		if (j == size || width >= 100)
+		{
+			this->_append_literal(format.data() + percent, j - percent);
+			i = j;
+			continue;
+		}
+
+		// Padding for numbers which have it by default.
+		auto pad = flag == '-' ? '\0' : (flag == '_' ? ' ' : '0');
+
+		// Padding for numbers which are space-padded by default.
+		auto space_pad = flag == '-' ? '\0' : (flag == '0' ? '0' : ' ');
+
+		// Padding of text to explicit width.
+		auto text_pad = flag == '0' ? '0' : ' ';
+
+		// Years are padded only to explicit width.
+		auto year_pad = width == 0 ? '\0' : pad;
+
+		// Width of numbers, or the default one if zero.
+		auto w = [width](unsigned char default_width) -> unsigned char {
+			return width ? (unsigned char)width : default_width;
+		};
+
+		auto conversion = format[j++];
+		switch (conversion)
+		{
+			case 'a': this->_append(Op::WeekdayShort, text_pad, width); break;
+			case 'A': this->_append(Op::WeekdayFull, text_pad, width); break;
+			case 'b':
+			case 'h': this->_append(Op::MonthShort, text_pad, width); break;
+			case 'B': this->_append(Op::MonthFull, text_pad, width); break;
+			case 'c': this->_compile("%a %b %e %H:%M:%S %Y", true); break;
+			case 'C': this->_append(Op::Century, year_pad, w(1)); break;
+			case 'd': this->_append(Op::Day, pad, w(2)); break;
+			case 'D':
+			case 'x': this->_compile("%m/%d/%y", true); break;
+			case 'e': this->_append(Op::DaySpace, space_pad, w(2)); break;
+			case 'f': this->_append(Op::Microsecond, pad, w(6)); break;
+			case 'F': this->_compile("%Y-%m-%d", true); break;
+			case 'g': this->_append(Op::IsoYearShort, pad, w(2)); break;
+			case 'G': this->_append(Op::IsoYear, year_pad, w(1)); break;
+			case 'H': this->_append(Op::Hour, pad, w(2)); break;
+			case 'I': this->_append(Op::Hour12, pad, w(2)); break;
+			case 'j': this->_append(Op::DayOfYear, pad, w(3)); break;
+			case 'k': this->_append(Op::HourSpace, space_pad, w(2)); break;
+			case 'l': this->_append(Op::Hour12Space, space_pad, w(2)); break;
+			case 'm': this->_append(Op::Month, pad, w(2)); break;
+			case 'M': this->_append(Op::Minute, pad, w(2)); break;
+			case 'n': this->_append_literal("\n", 1); break;
+			case 'p': this->_append(Op::AmPm, text_pad, width); break;
+			case 'P': this->_append(Op::AmPmLower, text_pad, width); break;
+			case 'r': this->_compile("%I:%M:%S %p", true); break;
+			case 'R': this->_compile("%H:%M", true); break;
+			case 'S': this->_append(Op::Second, pad, w(2)); break;
+			case 't': this->_append_literal("\t", 1); break;
+			case 'T':
+			case 'X': this->_compile("%H:%M:%S", true); break;
+			case 'u': this->_append(Op::WeekdayMonday1, pad, w(1)); break;
+			case 'U': this->_append(Op::WeekNumberSunday, pad, w(2)); break;
+			case 'V': this->_append(Op::IsoWeek, pad, w(2)); break;
+			case 'w': this->_append(Op::WeekdaySunday0, pad, w(1)); break;
+			case 'W': this->_append(Op::WeekNumberMonday, pad, w(2)); break;
+			case 'y': this->_append(Op::YearShort, pad, w(2)); break;
+			case 'Y': this->_append(Op::Year, year_pad, w(1)); break;
+			case 'z': this->_append(Op::UtcOffset, '\0', 0); break;
+			case 'Z': this->_append(Op::TzName, '\0', 0); break;
+			case '%': this->_append_literal("%", 1); break;
+			default:
+				this->_append_literal(format.data() + percent, j - percent);
+				break;
+		}
+
+		i = j;
+	}
+}
+
+size_t Formatter::_render(const Fields& fields, char* buffer) const
+{
+	// Calculated only if needed by the program.
+	_DateInfo info{};
+	bool has_info = false;
+	auto date_info = [&]() -> const _DateInfo& {
+		if (!has_info)
+		{
+			info = _date_info(fields);
+			has_info = true;
+		}
+
+		return info;
+	};
+
+	auto out = buffer;
+	for (const auto& inst : this->_program)
+	{
+		switch (inst.op)
+		{
+			case Op::Literal:
+				std::memcpy(out, this->_literals.data() + inst.offset, inst.size);
+				out += inst.size;
+				break;
+			case Op::WeekdayShort:
+				out = _write_text(out, _WEEKDAY_NAMES[date_info().weekday].substr(0, 3), inst.width, inst.pad);
+				break;
+			case Op::WeekdayFull:
+				out = _write_text(out, _WEEKDAY_NAMES[date_info().weekday], inst.width, inst.pad);
+				break;
+			case Op::MonthShort:
+				out = _write_text(out, fields.month >= 1 && fields.month <= _MONTHS_COUNT ?
+					_MONTH_FULL_NAMES[fields.month - 1].substr(0, 3) : "?", inst.width, inst.pad);
+				break;
+			case Op::MonthFull:
+				out = _write_text(out, fields.month >= 1 && fields.month <= _MONTHS_COUNT ?
+					_MONTH_FULL_NAMES[fields.month - 1] : "?", inst.width, inst.pad);
+				break;
+			case Op::Century:
+				out = _write_number(out, _floor_div(fields.year, 100), inst.width, inst.pad);
+				break;
+			case Op::Day:
+			case Op::DaySpace:
+				out = _write_number(out, fields.day, inst.width, inst.pad);
+				break;
+			case Op::Microsecond:
+				out = _write_number(out, fields.microsecond, inst.width, inst.pad);
+				break;
+			case Op::IsoYearShort:
+				out = _write_number(out, _mod(date_info().iso_year, 100L), inst.width, inst.pad);
+				break;
+			case Op::IsoYear:
+				out = _write_number(out, date_info().iso_year, inst.width, inst.pad);
+				break;
+			case Op::Hour:
+			case Op::HourSpace:
+				out = _write_number(out, fields.hour, inst.width, inst.pad);
+				break;
+			case Op::Hour12:
+			case Op::Hour12Space:
+				out = _write_number(out, fields.hour % 12 ? fields.hour % 12 : 12, inst.width, inst.pad);
+				break;
+			case Op::DayOfYear:
+				out = _write_number(out, date_info().year_day + 1, inst.width, inst.pad);
+				break;
+			case Op::Month:
+				out = _write_number(out, fields.month, inst.width, inst.pad);
+				break;
+			case Op::Minute:
+				out = _write_number(out, fields.minute, inst.width, inst.pad);
+				break;
+			case Op::AmPm:
+				out = _write_text(out, fields.hour < 12 ? "AM" : "PM", inst.width, inst.pad);
+				break;
+			case Op::AmPmLower:
+				out = _write_text(out, fields.hour < 12 ? "am" : "pm", inst.width, inst.pad);
+				break;
+			case Op::Second:
+				out = _write_number(out, fields.second, inst.width, inst.pad);
+				break;
+			case Op::WeekdayMonday1:
+				out = _write_number(out, date_info().weekday + 1, inst.width, inst.pad);
+				break;
+			case Op::WeekNumberSunday:
+			{
+				const auto& date = date_info();
+				auto sunday_weekday = (date.weekday + 1) % 7;
+				out = _write_number(out, (date.year_day + 7 - sunday_weekday) / 7, inst.width, inst.pad);
+				break;
+			}
+			case Op::IsoWeek:
+				out = _write_number(out, date_info().iso_week, inst.width, inst.pad);
+				break;
+			case Op::WeekdaySunday0:
+				out = _write_number(out, (date_info().weekday + 1) % 7, inst.width, inst.pad);
+				break;
+			case Op::WeekNumberMonday:
+			{
+				const auto& date = date_info();
+				out = _write_number(out, (date.year_day + 7 - date.weekday) / 7, inst.width, inst.pad);
+				break;
+			}
+			case Op::YearShort:
+				out = _write_number(out, _mod(fields.year, 100), inst.width, inst.pad);
+				break;
+			case Op::Year:
+				out = _write_number(out, fields.year, inst.width, inst.pad);
+				break;
+			case Op::UtcOffset:
+				if (fields.has_utc_offset)
+				{
+					out += _format_utc_offset(out, fields.utc_offset_seconds, fields.utc_offset_microseconds, false);
+				}
+
+				break;
+			case Op::TzName:
+				out = _write_text(out, fields.tz_name);
+				break;
+		}
+	}
+
+	return out - buffer;
+}
+
+Formatter::Fields Formatter::_fields(const Date& date) const
+{
+	Fields fields;
+	fields.year = date.year();
+	fields.month = date.month();
+	fields.day = date.day();
+	return fields;
+}
+
+Formatter::Fields Formatter::_fields(const Time& time) const
+{
+	Fields fields;
+	fields.year = 1900;
+	fields.hour = time.hour();
+	fields.minute = time.minute();
+	fields.second = time.second();
+	fields.microsecond = (int)time.microsecond();
+	if (this->_uses_utc_offset)
+	{
+		auto offset = time.utc_offset();
+		if (offset)
+		{
+			fields.has_utc_offset = true;
+			fields.utc_offset_seconds = (int)(offset->days() * 86400 + offset->seconds());
+			fields.utc_offset_microseconds = (int)offset->microseconds();
+		}
+	}
+
+	if (this->_tz_names_count)
+	{
+		fields.tz_name = time.tz_name();
+	}
+
+	return fields;
+}
+
+Formatter::Fields Formatter::_fields(const Datetime& datetime) const
+{
+	Fields fields;
+	fields.year = datetime.year();
+	fields.month = datetime.month();
+	fields.day = datetime.day();
+	fields.hour = datetime.hour();
+	fields.minute = datetime.minute();
+	fields.second = datetime.second();
+	fields.microsecond = (int)datetime.microsecond();
+	if (this->_uses_utc_offset && datetime.tz_info())
+	{
+		auto offset = datetime.utc_offset();
+		if (offset)
+		{
+			fields.has_utc_offset = true;
+			fields.utc_offset_seconds = (int)(offset->days() * 86400 + offset->seconds());
+			fields.utc_offset_microseconds = (int)offset->microseconds();
+		}
+	}
+
+	if (this->_tz_names_count)
+	{
+		fields.tz_name = datetime.tz_name();
+	}
+
+	return fields;
+}
+
+std::string Formatter::_format(const Fields& fields) const
+{
+	std::string result;
+	result.resize(this->max_size(fields.tz_name.size()));
+	result.resize(this->_render(fields, result.data()));
+	return result;
+}
+
+size_t Formatter::_format_to(char* buffer, size_t size, const Fields& fields) const
+{
+	if (size >= this->max_size(fields.tz_name.size()))
+	{
+		return this->_render(fields, buffer);
+	}
+
+	auto result = this->_format(fields);
+	if (result.size() <= size)
+	{
+		std::memcpy(buffer, result.data(), result.size());
+	}
+
+	return result.size();
+}
+
+Formatter::Formatter(std::string_view format)
+{
+	this->_compile(format, false);
+}
+
+size_t Formatter::max_size(size_t tz_name_size) const
+{
+	return this->_max_size + this->_tz_names_count * tz_name_size;
+}
+
+// Short names indexed by weekday, where Sunday == 0.
+static const char _IMF_DAY_NAMES[7][4] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+
+// Short names indexed by month, where January == 0.
+static const char _IMF_MONTH_NAMES[_MONTHS_COUNT][4] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+long _days_from_civil(long year, unsigned int month, unsigned int day)
+{
+	year -= month <= 2;
+	auto era = (year >= 0 ? year : year - 399) / 400;
+	auto year_of_era = (unsigned long)(year - era * 400);
+	auto day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	auto day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+	return era * 146097 + (long)day_of_era - 719468;
+}
+
+void _civil_from_days(long days, DatetimeFields& result)
+{
+	days += 719468;
+	auto era = (days >= 0 ? days : days - 146096) / 146097;
+	auto day_of_era = (unsigned long)(days - era * 146097);
+	auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+	auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+	auto shifted_month = (5 * day_of_year + 2) / 153;
+	result.day = (int)(day_of_year - (153 * shifted_month + 2) / 5 + 1);
+	result.month = (int)(shifted_month < 10 ? shifted_month + 3 : shifted_month - 9);
+	result.year = (int)(year_of_era + era * 400 + (result.month <= 2));
+}
+
+static inline char* _write_4_digits(char* out, unsigned int value)
+{
+	_write_2_digits(out, value / 100 % 100);
+	_write_2_digits(out + 2, value % 100);
+	return out + 4;
+}
+
+static inline char* _write_6_digits(char* out, unsigned int value)
+{
+	_write_2_digits(out, value / 10000 % 100);
+	_write_2_digits(out + 2, value / 100 % 100);
+	_write_2_digits(out + 4, value % 100);
+	return out + 6;
+}
+
+static inline char* _write_iso_date(char* out, int year, int month, int day)
+{
+	out = _write_4_digits(out, year);
+	*out++ = '-';
+	_write_2_digits(out, month);
+	out[2] = '-';
+	_write_2_digits(out + 3, day);
+	return out + 5;
+}
+
+static inline char* _write_iso_time(char* out, int hour, int minute, int second, int microsecond, time_spec ts)
+{
+	if (ts == time_spec::AUTO)
+	{
+		// Skip trailing microseconds when they are zero.
+		ts = microsecond ? time_spec::MICROSECONDS : time_spec::SECONDS;
+	}
+
+	_write_2_digits(out, hour);
+	out += 2;
+	if (ts == time_spec::HOURS)
+	{
+		return out;
+	}
+
+	*out++ = ':';
+	_write_2_digits(out, minute);
+	out += 2;
+	if (ts == time_spec::MINUTES)
+	{
+		return out;
+	}
+
+	*out++ = ':';
+	_write_2_digits(out, second);
+	out += 2;
+	switch (ts)
+	{
+		case time_spec::SECONDS:
+			break;
+		case time_spec::MILLISECONDS:
+			*out++ = '.';
+			*out++ = (char)('0' + microsecond / 100000);
+			_write_2_digits(out, microsecond / 1000 % 100);
+			out += 2;
+			break;
+		case time_spec::MICROSECONDS:
+			*out++ = '.';
+			out = _write_6_digits(out, microsecond);
+			break;
+		default:
+			throw std::invalid_argument("dt: unknown time_spec value");
+	}
+
+	return out;
+}
+
+// Returns the offset as seconds and microseconds, or `false` if there
+// is no offset.
+static inline bool _utc_offset(const std::shared_ptr<Timedelta>& offset, long& seconds, long& microseconds)
+{
+	if (!offset)
+	{
+		return false;
+	}
+
+	seconds = offset->days() * 86400 + offset->seconds();
+	microseconds = offset->microseconds();
+	return true;
+}
+
+size_t _format_utc_offset(char* buffer, long seconds, long microseconds, bool colons)
+{
+	auto out = buffer;
+	auto total = seconds * 1000000 + microseconds;
+	*out++ = total < 0 ? '-' : '+';
+	if (total < 0)
+	{
+		total = -total;
+	}
+
+	microseconds = total % 1000000;
+	seconds = total / 1000000;
+	out = _write_number(out, seconds / 3600, 2, '0');
+	if (colons)
+	{
+		*out++ = ':';
+	}
+
+	_write_2_digits(out, seconds / 60 % 60);
+	out += 2;
+	if (seconds % 60 || microseconds)
+	{
+		if (colons)
+		{
+			*out++ = ':';
+		}
+
+		_write_2_digits(out, seconds % 60);
+		out += 2;
+	}
+
+	if (microseconds)
+	{
+		*out++ = '.';
+		out = _write_6_digits(out, microseconds);
+	}
+
+	return out - buffer;
+}
+
+size_t format_iso_date(char* buffer, const Date& date)
+{
+	return _write_iso_date(buffer, date.year(), date.month(), date.day()) - buffer;
+}
+
+size_t format_iso_time(char* buffer, const Time& time, time_spec ts)
+{
+	auto out = _write_iso_time(buffer, time.hour(), time.minute(), time.second(), (int)time.microsecond(), ts);
+	long seconds, microseconds;
+	if (time.tz_info() && _utc_offset(time.utc_offset(), seconds, microseconds))
+	{
+		out += _format_utc_offset(out, seconds, microseconds, true);
+	}
+
+	return out - buffer;
+}
+
+size_t format_iso_datetime(char* buffer, const Datetime& datetime, char sep, time_spec ts)
+{
+	auto out = _write_iso_date(buffer, datetime.year(), datetime.month(), datetime.day());
+	*out++ = sep;
+	out = _write_iso_time(
+		out, datetime.hour(), datetime.minute(), datetime.second(), (int)datetime.microsecond(), ts
+	);
+	long seconds, microseconds;
+	if (datetime.tz_info() && _utc_offset(datetime.utc_offset(), seconds, microseconds))
+	{
+		out += _format_utc_offset(out, seconds, microseconds, true);
+	}
+
+	return out - buffer;
+}
+
+size_t format_iso_datetime(char* buffer, const DatetimeFields& fields, char sep, time_spec ts)
+{
+	auto out = _write_iso_date(buffer, fields.year, fields.month, fields.day);
+	*out++ = sep;
+	out = _write_iso_time(out, fields.hour, fields.minute, fields.second, fields.microsecond, ts);
+	if (fields.has_utc_offset)
+	{
+		out += _format_utc_offset(out, fields.utc_offset_seconds, fields.utc_offset_microseconds, true);
+	}
+
+	return out - buffer;
+}
+
+size_t _format_imf_date_time(char* buffer, const DatetimeFields& fields)
+{
+	auto days = _days_from_civil(fields.year, fields.month, fields.day);
+	auto out = buffer;
+	std::memcpy(out, _IMF_DAY_NAMES[_mod(days + 4, 7L)], 3);
+	out[3] = ',';
+	out[4] = ' ';
+	_write_2_digits(out + 5, fields.day);
+	out[7] = ' ';
+	std::memcpy(out + 8, _IMF_MONTH_NAMES[_mod(fields.month - 1, _MONTHS_COUNT)], 3);
+	out[11] = ' ';
+	_write_4_digits(out + 12, fields.year);
+	out[16] = ' ';
+	_write_2_digits(out + 17, fields.hour);
+	out[19] = ':';
+	_write_2_digits(out + 20, fields.minute);
+	out[22] = ':';
+	_write_2_digits(out + 23, fields.second);
+	return 25;
+}
+
+static inline size_t _format_imf_fixdate(char* buffer, long seconds)
+{
+	DatetimeFields fields;
+	auto days = seconds / 86400 - (seconds % 86400 < 0);
+	auto seconds_of_day = seconds - days * 86400;
+	_civil_from_days(days, fields);
+	fields.hour = (int)(seconds_of_day / 3600);
+	fields.minute = (int)(seconds_of_day / 60 % 60);
+	fields.second = (int)(seconds_of_day % 60);
+	auto size = _format_imf_date_time(buffer, fields);
+	std::memcpy(buffer + size, " GMT", 4);
+	return size + 4;
+}
+
+size_t format_imf_fixdate(char* buffer, const Datetime& datetime)
+{
+	long seconds = _days_from_civil(datetime.year(), datetime.month(), datetime.day()) * 86400 +
+		datetime.hour() * 3600 + datetime.minute() * 60 + datetime.second();
+	long offset_seconds, offset_microseconds;
+	if (datetime.tz_info() && _utc_offset(datetime.utc_offset(), offset_seconds, offset_microseconds))
+	{
+		// Seconds are truncated, so carry the borrow from microseconds.
+		seconds -= offset_seconds + ((long)datetime.microsecond() - offset_microseconds < 0);
+	}
+
+	return _format_imf_fixdate(buffer, seconds);
+}
+
+size_t format_imf_fixdate(char* buffer, time_t timestamp)
+{
+	return _format_imf_fixdate(buffer, (long)timestamp);
+}
+
+// Parses `size` decimal digits into `result`.
+//
+// Returns `false` if any of the characters is not a digit.
+static inline bool _parse_digits(const char* s, size_t size, int& result)
+{
+	int value = 0;
+	unsigned int invalid = 0;
+	for (size_t i = 0; i < size; i++)
+	{
+		auto digit = (unsigned int)(unsigned char)s[i] - '0';
+		invalid |= digit > 9;
+		value = value * 10 + (int)digit;
+	}
+
+	result = value;
+	return !invalid;
+}
+
+// Parses 'HH[:MM[:SS[.fff[fff]]]]'.
+static inline bool _parse_hh_mm_ss_ff(std::string_view s, int& hour, int& minute, int& second, int& microsecond)
+{
+	hour = minute = second = microsecond = 0;
+	auto size = s.size();
+	if (size < 2 || !_parse_digits(s.data(), 2, hour))
+	{
+		return false;
+	}
+
+	if (size == 2)
+	{
+		return true;
+	}
+
+	if (size < 5 || s[2] != ':' || !_parse_digits(s.data() + 3, 2, minute))
+	{
+		return false;
+	}
+
+	if (size == 5)
+	{
+		return true;
+	}
+
+	if (size < 8 || s[5] != ':' || !_parse_digits(s.data() + 6, 2, second))
+	{
+		return false;
+	}
+
+	if (size == 8)
+	{
+		return true;
+	}
+
+	if (s[8] != '.' || (size != 12 && size != 15) || !_parse_digits(s.data() + 9, size - 9, microsecond))
+	{
+		return false;
+	}
+
+	if (size == 12)
+	{
+		microsecond *= 1000;
+	}
+
+	return true;
+}
+
+bool parse_iso_date(std::string_view s, DatetimeFields& result)
+{
+	return s.size() == ISO_DATE_SIZE && s[4] == '-' && s[7] == '-' &&
+		_parse_digits(s.data(), 4, result.year) &
+		_parse_digits(s.data() + 5, 2, result.month) &
+		_parse_digits(s.data() + 8, 2, result.day);
+}
+
+bool parse_iso_time(std::string_view s, DatetimeFields& result)
+{
+	auto tz_pos = s.find_first_of("+-Z");
+	result.has_utc_offset = false;
+	result.utc_offset_seconds = result.utc_offset_microseconds = 0;
+	if (!_parse_hh_mm_ss_ff(s.substr(0, tz_pos), result.hour, result.minute, result.second, result.microsecond))
+	{
+		return false;
+	}
+
+	if (tz_pos == std::string_view::npos)
+	{
+		return true;
+	}
+
+	result.has_utc_offset = true;
+	if (s[tz_pos] == 'Z')
+	{
+		return tz_pos + 1 == s.size();
+	}
+
+	// Valid time zone strings are:
+	//  HH:MM               len: 5
+	//  HH:MM:SS            len: 8
+	//  HH:MM:SS.ffffff     len: 15
+	auto tz = s.substr(tz_pos + 1);
+	int hours, minutes, seconds, microseconds;
+	if (
+		(tz.size() != 5 && tz.size() != 8 && tz.size() != 15) ||
+		!_parse_hh_mm_ss_ff(tz, hours, minutes, seconds, microseconds)
+	)
+	{
+		return false;
+	}
+
+	auto sign = s[tz_pos] == '-' ? -1 : 1;
+	result.utc_offset_seconds = sign * (hours * 3600 + minutes * 60 + seconds);
+	result.utc_offset_microseconds = sign * microseconds;
+	return true;
+}
+
+bool parse_iso_datetime(std::string_view s, DatetimeFields& result)
+{
+	if (!parse_iso_date(s.substr(0, ISO_DATE_SIZE), result))
+	{
+		return false;
+	}
+
+	result.hour = result.minute = result.second = result.microsecond = 0;
+	result.has_utc_offset = false;
+	result.utc_offset_seconds = result.utc_offset_microseconds = 0;
+	if (s.size() <= ISO_DATE_SIZE + 1)
+	{
+		return true;
+	}
+
+	return parse_iso_time(s.substr(ISO_DATE_SIZE + 1), result);
+}
+
+bool parse_imf_fixdate(std::string_view s, DatetimeFields& result)
+{
+	if (
+		s.size() != IMF_FIXDATE_SIZE || s[3] != ',' || s[4] != ' ' || s[7] != ' ' || s[11] != ' ' ||
+		s[16] != ' ' || s[19] != ':' || s[22] != ':' || s.substr(25) != " GMT"
+	)
+	{
+		return false;
+	}
+
+	bool is_day_name = false;
+	for (const auto& name : _IMF_DAY_NAMES)
+	{
+		is_day_name |= std::memcmp(s.data(), name, 3) == 0;
+	}
+
+	result.month = 0;
+	for (int i = 0; i < _MONTHS_COUNT; i++)
+	{
+		if (std::memcmp(s.data() + 8, _IMF_MONTH_NAMES[i], 3) == 0)
+		{
+			result.month = i + 1;
+		}
+	}
+
+	result.microsecond = 0;
+	result.has_utc_offset = true;
+	result.utc_offset_seconds = result.utc_offset_microseconds = 0;
+	return is_day_name && result.month &&
+		_parse_digits(s.data() + 5, 2, result.day) &
+		_parse_digits(s.data() + 12, 4, result.year) &
+		_parse_digits(s.data() + 17, 2, result.hour) &
+		_parse_digits(s.data() + 20, 2, result.minute) &
+		_parse_digits(s.data() + 23, 2, result.second);
+}
+
+__DATETIME_END__
@@ -0,0 +1,300 @@
+/**
+ * datetime_format.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Fast formatting and parsing of date/time values.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <ctime>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./datetime.h"
+
+
+__DATETIME_BEGIN__
+
+// Broken-down date and time with optional UTC offset.
+struct DatetimeFields
+{
+	int year = 1970;
+	int month = 1;
+	int day = 1;
+	int hour = 0;
+	int minute = 0;
+	int second = 0;
+	int microsecond = 0;
+
+	// UTC offset, ignored if `has_utc_offset` is `false`.
+	bool has_utc_offset = false;
+	int utc_offset_seconds = 0;
+	int utc_offset_microseconds = 0;
+};
+
+// Format string compiled into a program of simple operations. Compile it
+// once and reuse, rendering does not parse the format and does not call
+// C 'strftime'.
+//
+// The output is the same as of `Datetime::strftime` in "C" locale.
+// Supported directives:
+//	%a %A %b %h %B %c %C %d %D %e %f %F %g %G %H %I %j %k %l %m %M %n %p
+//	%P %r %R %S %t %T %u %U %V %w %W %x %X %y %Y %z %Z %%,
+//	flags '-' (no padding), '_' (pad with spaces), '0' (pad with zeros),
+//	width of numbers and ignored modifiers 'E' and 'O'.
+// Other directives are copied to the output as is.
+//
+// Unlike `strftime`, day of the year and week numbers are always
+// calculated from the date.
+class Formatter final
+{
+public:
+	enum class Op : unsigned char
+	{
+		Literal,
+		WeekdayShort, WeekdayFull, MonthShort, MonthFull,
+		Century, Day, DaySpace, Microsecond, IsoYearShort, IsoYear,
+		Hour, Hour12, HourSpace, Hour12Space, DayOfYear, Month, Minute,
+		AmPm, AmPmLower, Second, WeekdayMonday1, WeekNumberSunday, IsoWeek,
+		WeekdaySunday0, WeekNumberMonday, YearShort, Year, UtcOffset, TzName
+	};
+
+	struct Inst
+	{
+		Op op;
+
+		// Padding character or '\0' for no padding, and the minimum
+		// width of the output.
+		char pad;
+		unsigned char width;
+
+		// Literal text in `_literals`.
+		unsigned int offset;
+		unsigned int size;
+	};
+
+	// Values used by the program: broken-down date and time with the
+	// name of time zone. UTC offset is used only if the format contains
+	// '%z', the name only if it contains '%Z'.
+	struct Fields : DatetimeFields
+	{
+		std::string tz_name;
+
+		Fields() = default;
+
+		inline Fields(const DatetimeFields& fields, std::string tz_name={}) :
+			DatetimeFields(fields), tz_name(std::move(tz_name))
+		{
+		}
+	};
+
+private:
+	std::vector<Inst> _program;
+	std::string _literals;
+
+	// Maximum size of the output excluding time zone name.
+	size_t _max_size = 0;
+
+	bool _uses_utc_offset = false;
+	size_t _tz_names_count = 0;
+
+	void _append_literal(const char* data, size_t size);
+
+	void _append(Op op, char pad, unsigned char width);
+
+	void _compile(std::string_view format, bool nested);
+
+	[[nodiscard]]
+	size_t _render(const Fields& fields, char* buffer) const;
+
+	[[nodiscard]]
+	Fields _fields(const Date& date) const;
+
+	[[nodiscard]]
+	Fields _fields(const Time& time) const;
+
+	[[nodiscard]]
+	Fields _fields(const Datetime& datetime) const;
+
+	[[nodiscard]]
+	std::string _format(const Fields& fields) const;
+
+	[[nodiscard]]
+	size_t _format_to(char* buffer, size_t size, const Fields& fields) const;
+
+public:
+	// Compiles `format`.
+	explicit Formatter(std::string_view format);
+
+	// Returns compiled program.
+	[[nodiscard]]
+	inline const std::vector<Inst>& program() const
+	{
+		return this->_program;
+	}
+
+	// Returns the maximum size of the output if time zone name is
+	// not longer than `tz_name_size`.
+	[[nodiscard]]
+	size_t max_size(size_t tz_name_size=0) const;
+
+	// Renders given values.
+	[[nodiscard]]
+	inline std::string format(const Fields& fields) const
+	{
+		return this->_format(fields);
+	}
+
+	// Renders the date. Time is midnight without time zone.
+	[[nodiscard]]
+	inline std::string format(const Date& date) const
+	{
+		return this->_format(this->_fields(date));
+	}
+
+	// Renders the time. Date is January 1, 1900.
+	[[nodiscard]]
+	inline std::string format(const Time& time) const
+	{
+		return this->_format(this->_fields(time));
+	}
+
+	[[nodiscard]]
+	inline std::string format(const Datetime& datetime) const
+	{
+		return this->_format(this->_fields(datetime));
+	}
+
+	// Renders given values into `buffer` of `size` bytes. The output
+	// is not null-terminated.
+	//
+	// Returns the size of the output. If it is greater than `size`,
+	// nothing is written.
+	inline size_t format_to(char* buffer, size_t size, const Fields& fields) const
+	{
+		return this->_format_to(buffer, size, fields);
+	}
+
+	inline size_t format_to(char* buffer, size_t size, const Date& date) const
+	{
+		return this->_format_to(buffer, size, this->_fields(date));
+	}
+
+	inline size_t format_to(char* buffer, size_t size, const Time& time) const
+	{
+		return this->_format_to(buffer, size, this->_fields(time));
+	}
+
+	inline size_t format_to(char* buffer, size_t size, const Datetime& datetime) const
+	{
+		return this->_format_to(buffer, size, this->_fields(datetime));
+	}
+};
+
+// Writes `value` as two decimal digits.
+extern void _write_2_digits(char* buffer, unsigned int value);
+
+// Buffer sizes for fixed-width formatters below.
+//
+// 'YYYY-MM-DD'.
+const size_t ISO_DATE_SIZE = 10;
+
+// 'HH:MM:SS.ffffff+HH:MM:SS.ffffff'.
+const size_t ISO_TIME_MAX_SIZE = 31;
+
+// Date, separator and time.
+const size_t ISO_DATETIME_MAX_SIZE = ISO_DATE_SIZE + 1 + ISO_TIME_MAX_SIZE;
+
+// 'Sun, 06 Nov 1994 08:49:37 GMT'.
+const size_t IMF_FIXDATE_SIZE = 29;
+
+// Writes the date as 'YYYY-MM-DD' into `buffer` of at least
+// `ISO_DATE_SIZE` bytes.
+//
+// Returns the number of written characters.
+extern size_t format_iso_date(char* buffer, const Date& date);
+
+// Writes the time in the format of `Time::iso_format` into `buffer` of
+// at least `ISO_TIME_MAX_SIZE` bytes.
+//
+// Returns the number of written characters.
+extern size_t format_iso_time(char* buffer, const Time& time, time_spec ts=time_spec::AUTO);
+
+// Writes the datetime in the format of `Datetime::iso_format` into
+// `buffer` of at least `ISO_DATETIME_MAX_SIZE` bytes.
+//
+// Returns the number of written characters.
+extern size_t format_iso_datetime(
+	char* buffer, const Datetime& datetime, char sep='T', time_spec ts=time_spec::AUTO
+);
+
+// Same as above for broken-down values.
+extern size_t format_iso_datetime(
+	char* buffer, const DatetimeFields& fields, char sep='T', time_spec ts=time_spec::AUTO
+);
+
+// Writes the datetime converted to UTC as IMF-fixdate (RFC 7231), for
+// example 'Sun, 06 Nov 1994 08:49:37 GMT', into `buffer` of at least
+// `IMF_FIXDATE_SIZE` bytes. Naive datetime is treated as UTC.
+//
+// Returns the number of written characters.
+extern size_t format_imf_fixdate(char* buffer, const Datetime& datetime);
+
+// Same as above for POSIX timestamp.
+extern size_t format_imf_fixdate(char* buffer, time_t timestamp);
+
+// Parses 'YYYY-MM-DD'.
+//
+// Returns `false` if the syntax is invalid. Ranges are not checked.
+extern bool parse_iso_date(std::string_view s, DatetimeFields& result);
+
+// Parses 'HH[:MM[:SS[.fff[fff]]]]' followed by optional UTC offset
+// '+HH:MM[:SS[.ffffff]]', '-HH:MM[:SS[.ffffff]]' or 'Z'.
+//
+// Returns `false` if the syntax is invalid. Ranges are not checked.
+extern bool parse_iso_time(std::string_view s, DatetimeFields& result);
+
+// Parses ISO date optionally followed by any separator character and
+// ISO time.
+//
+// Returns `false` if the syntax is invalid. Ranges are not checked.
+extern bool parse_iso_datetime(std::string_view s, DatetimeFields& result);
+
+// Parses IMF-fixdate, for example 'Sun, 06 Nov 1994 08:49:37 GMT'. The
+// result has zero UTC offset.
+//
+// Returns `false` if the syntax is invalid. Ranges are not checked.
+extern bool parse_imf_fixdate(std::string_view s, DatetimeFields& result);
+
+// Writes 'Sun, 06 Nov 1994 08:49:37' into `buffer` of at least 25 bytes.
+//
+// Returns the number of written characters.
+extern size_t _format_imf_date_time(char* buffer, const DatetimeFields& fields);
+
+// Writes UTC offset as '+HH:MM[:SS[.ffffff]]', or without colons if
+// `colons` is `false`, into `buffer` of at least 16 bytes.
+//
+// Returns the number of written characters.
+extern size_t _format_utc_offset(char* buffer, long seconds, long microseconds, bool colons);
+
+// Proleptic Gregorian ordinal of 1970-01-01.
+const long _UNIX_EPOCH_ORDINAL = 719163;
+
+// Returns days since 1970-01-01 of proleptic Gregorian date. The values
+// are not checked. Other day counts are derived from it.
+extern long _days_from_civil(long year, unsigned int month, unsigned int day);
+
+// Sets year, month and day of `result` to proleptic Gregorian date of
+// `days` since 1970-01-01.
+extern void _civil_from_days(long days, DatetimeFields& result);
+
+__DATETIME_END__
@@ -0,0 +1,737 @@
+/**
+ * datetime_zoneinfo.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./datetime_zoneinfo.h"
+
+// C++ libraries.
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+
+__DATETIME_BEGIN__
+
+static const size_t _TZIF_HEADER_SIZE = 44;
+
+static inline uint32_t _read_u32(const char* data)
+{
+	auto p = (const unsigned char*)data;
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline int64_t _read_i64(const char* data)
+{
+	return (int64_t)(((uint64_t)_read_u32(data) << 32) | _read_u32(data + 4));
+}
+
+[[noreturn]]
+static void _throw_invalid(const std::string& key, const std::string& reason)
+{
+	throw std::invalid_argument("dt: invalid time zone data '" + key + "': " + reason);
+}
+
+// Counts from TZif header.
+struct _TzifCounts
+{
+	uint32_t is_ut = 0;
+	uint32_t is_std = 0;
+	uint32_t leap = 0;
+	uint32_t time = 0;
+	uint32_t type = 0;
+	uint32_t chars = 0;
+
+	// Size of the data block following the header.
+	[[nodiscard]]
+	inline size_t block_size(size_t time_size) const
+	{
+		return this->time * (time_size + 1) + this->type * 6 + this->chars +
+			this->leap * (time_size + 4) + this->is_std + this->is_ut;
+	}
+};
+
+static inline bool _read_tzif_header(std::string_view data, size_t pos, char& version, _TzifCounts& counts)
+{
+	if (data.size() < pos + _TZIF_HEADER_SIZE || data.substr(pos, 4) != "TZif")
+	{
+		return false;
+	}
+
+	auto header = data.data() + pos;
+	version = header[4];
+	counts.is_ut = _read_u32(header + 20);
+	counts.is_std = _read_u32(header + 24);
+	counts.leap = _read_u32(header + 28);
+	counts.time = _read_u32(header + 32);
+	counts.type = _read_u32(header + 36);
+	counts.chars = _read_u32(header + 40);
+	return true;
+}
+
+void ZoneInfo::_parse_tzif(std::string_view data)
+{
+	char version;
+	_TzifCounts counts;
+	if (!_read_tzif_header(data, 0, version, counts))
+	{
+		_throw_invalid(this->_key, "missing TZif header");
+	}
+
+	// Version 2 and later repeat the data with 64-bit times after the
+	// version 1 block, which is skipped.
+	size_t pos = _TZIF_HEADER_SIZE;
+	size_t time_size = 4;
+	if (version >= '2')
+	{
+		pos += counts.block_size(4);
+		if (!_read_tzif_header(data, pos, version, counts))
+		{
+			_throw_invalid(this->_key, "missing second TZif header");
+		}
+
+		pos += _TZIF_HEADER_SIZE;
+		time_size = 8;
+	}
+
+	if (counts.type == 0 || counts.type > 256 || counts.chars == 0 ||
+		data.size() - pos < counts.block_size(time_size))
+	{
+		_throw_invalid(this->_key, "wrong counts");
+	}
+
+	auto block = data.data() + pos;
+	this->_transitions.resize(counts.time);
+	for (size_t i = 0; i < counts.time; i++, block += time_size)
+	{
+		this->_transitions[i] = time_size == 8 ? _read_i64(block) : (int32_t)_read_u32(block);
+		if (i > 0 && this->_transitions[i] <= this->_transitions[i - 1])
+		{
+			_throw_invalid(this->_key, "transitions are not sorted");
+		}
+	}
+
+	this->_transition_types.assign(block, block + counts.time);
+	for (auto type : this->_transition_types)
+	{
+		if (type >= counts.type)
+		{
+			_throw_invalid(this->_key, "wrong transition type");
+		}
+	}
+
+	block += counts.time;
+	auto chars = block + counts.type * 6;
+	this->_types.resize(counts.type);
+	for (auto& type : this->_types)
+	{
+		type.utc_offset = (int32_t)_read_u32(block);
+		type.is_dst = block[4] != 0;
+		auto index = (unsigned char)block[5];
+		if (index >= counts.chars)
+		{
+			_throw_invalid(this->_key, "wrong abbreviation index");
+		}
+
+		type.abbreviation.assign(chars + index, strnlen(chars + index, counts.chars - index));
+		block += 6;
+	}
+
+	// Leap seconds and standard/UT indicators are not used.
+	pos = block + counts.chars + counts.leap * (time_size + 4) + counts.is_std + counts.is_ut - data.data();
+	if (time_size == 8)
+	{
+		auto footer = data.substr(pos);
+		auto end = footer.size() > 1 && footer[0] == '\n' ? footer.find('\n', 1) : std::string_view::npos;
+		if (end == std::string_view::npos)
+		{
+			_throw_invalid(this->_key, "missing footer");
+		}
+
+		footer = footer.substr(1, end - 1);
+		if (!footer.empty() && !this->_parse_footer(footer))
+		{
+			_throw_invalid(this->_key, "wrong footer '" + std::string(footer) + "'");
+		}
+	}
+
+	this->_compute_dst_offsets();
+}
+
+// Parses name of POSIX TZ: alphabetic or quoted in '<>'.
+static inline bool _parse_tz_name(std::string_view s, size_t& pos, std::string& name)
+{
+	if (pos < s.size() && s[pos] == '<')
+	{
+		auto end = s.find('>', pos);
+		if (end == std::string_view::npos)
+		{
+			return false;
+		}
+
+		name = s.substr(pos + 1, end - pos - 1);
+		pos = end + 1;
+	}
+	else
+	{
+		auto start = pos;
+		while (pos < s.size() && std::isalpha((unsigned char)s[pos]))
+		{
+			pos++;
+		}
+
+		name = s.substr(start, pos - start);
+	}
+
+	return !name.empty();
+}
+
+// Parses '[+|-]hh[:mm[:ss]]' as seconds.
+static inline bool _parse_tz_time(std::string_view s, size_t& pos, int32_t& result)
+{
+	int32_t sign = 1;
+	if (pos < s.size() && (s[pos] == '+' || s[pos] == '-'))
+	{
+		sign = s[pos++] == '-' ? -1 : 1;
+	}
+
+	int32_t parts[3] = {0, 0, 0};
+	for (size_t i = 0; i < 3; i++)
+	{
+		if (i > 0)
+		{
+			if (pos >= s.size() || s[pos] != ':')
+			{
+				break;
+			}
+
+			pos++;
+		}
+
+		size_t digits = 0;
+		while (pos < s.size() && digits < 3 && std::isdigit((unsigned char)s[pos]))
+		{
+			parts[i] = parts[i] * 10 + (s[pos++] - '0');
+			digits++;
+		}
+
+		if (digits == 0)
+		{
+			return false;
+		}
+	}
+
+	if (parts[0] > 167 || parts[1] > 59 || parts[2] > 59)
+	{
+		return false;
+	}
+
+	result = sign * (parts[0] * 3600 + parts[1] * 60 + parts[2]);
+	return true;
+}
+
+static inline bool _parse_tz_number(std::string_view s, size_t& pos, int min, int max, int& result)
+{
+	auto start = pos;
+	result = 0;
+	while (pos < s.size() && pos - start < 3 && std::isdigit((unsigned char)s[pos]))
+	{
+		result = result * 10 + (s[pos++] - '0');
+	}
+
+	return pos > start && result >= min && result <= max;
+}
+
+bool ZoneInfo::_parse_footer(std::string_view tz)
+{
+	size_t pos = 0;
+	LocalTimeType std_type, dst_type;
+	int32_t offset;
+
+	// POSIX offsets are positive for west of UTC.
+	if (!_parse_tz_name(tz, pos, std_type.abbreviation) || !_parse_tz_time(tz, pos, offset))
+	{
+		return false;
+	}
+
+	std_type.utc_offset = -offset;
+	this->_types.push_back(std_type);
+	this->_footer_std = this->_footer_dst = this->_types.size() - 1;
+	this->_has_footer = true;
+	if (pos == tz.size())
+	{
+		return true;
+	}
+
+	if (!_parse_tz_name(tz, pos, dst_type.abbreviation))
+	{
+		return false;
+	}
+
+	dst_type.is_dst = true;
+	dst_type.utc_offset = std_type.utc_offset + 3600;
+	if (pos < tz.size() && tz[pos] != ',')
+	{
+		if (!_parse_tz_time(tz, pos, offset))
+		{
+			return false;
+		}
+
+		dst_type.utc_offset = -offset;
+	}
+
+	dst_type.dst_offset = dst_type.utc_offset - std_type.utc_offset;
+	this->_types.push_back(dst_type);
+	this->_footer_dst = this->_types.size() - 1;
+	this->_footer_has_dst = true;
+	if (pos == tz.size())
+	{
+		// US rules are the default.
+		this->_dst_start = {_DateRule::Kind::MonthWeekDay, 0, 3, 2, 7200};
+		this->_dst_end = {_DateRule::Kind::MonthWeekDay, 0, 11, 1, 7200};
+		return true;
+	}
+
+	for (auto rule : {&this->_dst_start, &this->_dst_end})
+	{
+		if (pos >= tz.size() || tz[pos++] != ',')
+		{
+			return false;
+		}
+
+		if (pos < tz.size() && tz[pos] == 'J')
+		{
+			pos++;
+			rule->kind = _DateRule::Kind::Julian;
+			if (!_parse_tz_number(tz, pos, 1, 365, rule->day))
+			{
+				return false;
+			}
+		}
+		else if (pos < tz.size() && tz[pos] == 'M')
+		{
+			pos++;
+			rule->kind = _DateRule::Kind::MonthWeekDay;
+			if (!_parse_tz_number(tz, pos, 1, 12, rule->month) ||
+				pos >= tz.size() || tz[pos++] != '.' ||
+				!_parse_tz_number(tz, pos, 1, 5, rule->week) ||
+				pos >= tz.size() || tz[pos++] != '.' ||
+				!_parse_tz_number(tz, pos, 0, 6, rule->day))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			rule->kind = _DateRule::Kind::Day;
+			if (!_parse_tz_number(tz, pos, 0, 365, rule->day))
+			{
+				return false;
+			}
+		}
+
+		if (pos < tz.size() && tz[pos] == '/')
+		{
+			pos++;
+			if (!_parse_tz_time(tz, pos, rule->time))
+			{
+				return false;
+			}
+		}
+	}
+
+	return pos == tz.size();
+}
+
+void ZoneInfo::_compute_dst_offsets()
+{
+	// TZif stores only the DST flag, so the DST part of the offset is
+	// taken from the nearest transition between standard time and DST.
+	std::vector<bool> computed(this->_types.size(), false);
+	for (size_t i = 0; i < this->_transition_types.size(); i++)
+	{
+		auto& type = this->_types[this->_transition_types[i]];
+		if (!type.is_dst || computed[this->_transition_types[i]])
+		{
+			continue;
+		}
+
+		const LocalTimeType* standard = nullptr;
+		if (i > 0 && !this->_types[this->_transition_types[i - 1]].is_dst)
+		{
+			standard = &this->_types[this->_transition_types[i - 1]];
+		}
+		else if (i + 1 < this->_transition_types.size() && !this->_types[this->_transition_types[i + 1]].is_dst)
+		{
+			standard = &this->_types[this->_transition_types[i + 1]];
+		}
+
+		if (standard)
+		{
+			type.dst_offset = type.utc_offset - standard->utc_offset;
+			computed[this->_transition_types[i]] = true;
+		}
+	}
+
+	for (size_t i = 0; i < this->_types.size(); i++)
+	{
+		auto& type = this->_types[i];
+		if (type.is_dst && !computed[i] && type.dst_offset == 0)
+		{
+			type.dst_offset = 3600;
+		}
+	}
+}
+
+int64_t ZoneInfo::_rule_day(const _DateRule& rule, int year)
+{
+	auto first_day = _days_from_civil(year, 1, 1);
+	switch (rule.kind)
+	{
+		case _DateRule::Kind::Julian:
+		{
+			bool is_leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+			return first_day + rule.day - 1 + (is_leap && rule.day >= 60 ? 1 : 0);
+		}
+		case _DateRule::Kind::Day:
+			return first_day + rule.day;
+		default:
+			break;
+	}
+
+	// 1970-01-01 is Thursday.
+	int64_t month_start = _days_from_civil(year, rule.month, 1);
+	int64_t next_month_start = rule.month == 12 ?
+		_days_from_civil(year + 1, 1, 1) : _days_from_civil(year, rule.month + 1, 1);
+	auto weekday = ((month_start + 4) % 7 + 7) % 7;
+	auto day = month_start + (rule.day - weekday + 7) % 7 + 7 * (rule.week - 1);
+	while (day >= next_month_start)
+	{
+		day -= 7;
+	}
+
+	return day;
+}
+
+size_t ZoneInfo::_footer_type(int64_t seconds) const
+{
+	if (!this->_footer_has_dst)
+	{
+		return this->_footer_std;
+	}
+
+	auto std_offset = this->_types[this->_footer_std].utc_offset;
+	auto dst_offset = this->_types[this->_footer_dst].utc_offset;
+	DatetimeFields fields;
+	_civil_from_days((long)_floor_div(seconds + std_offset, 86400), fields);
+	auto start = _rule_day(this->_dst_start, fields.year) * 86400 + this->_dst_start.time - std_offset;
+	auto end = _rule_day(this->_dst_end, fields.year) * 86400 + this->_dst_end.time - dst_offset;
+	bool is_dst = start < end ? (start <= seconds && seconds < end) : !(end <= seconds && seconds < start);
+	return is_dst ? this->_footer_dst : this->_footer_std;
+}
+
+std::shared_ptr<const ZoneInfo> ZoneInfo::from_tzif(const std::string& key, std::string_view data)
+{
+	auto zone = std::shared_ptr<ZoneInfo>(new ZoneInfo());
+	zone->_key = key;
+	zone->_parse_tzif(data);
+	return zone;
+}
+
+std::shared_ptr<const ZoneInfo> ZoneInfo::from_posix_tz(const std::string& tz)
+{
+	auto zone = std::shared_ptr<ZoneInfo>(new ZoneInfo());
+	zone->_key = tz;
+	if (!zone->_parse_footer(tz))
+	{
+		_throw_invalid(tz, "wrong POSIX TZ string");
+	}
+
+	zone->_compute_dst_offsets();
+	return zone;
+}
+
+static inline bool _read_file(const std::string& path, std::string& result)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	result.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return !file.bad();
+}
+
+static inline std::string _zoneinfo_dir()
+{
+	auto dir = std::getenv("TZDIR");
+	return dir && *dir ? dir : "/usr/share/zoneinfo";
+}
+
+// Keys are relative paths inside the zoneinfo directory.
+static inline bool _is_valid_key(const std::string& key)
+{
+	if (key.empty() || key.front() == '/' || key.find('\0') != std::string::npos)
+	{
+		return false;
+	}
+
+	size_t start = 0;
+	while (start <= key.size())
+	{
+		auto end = std::min(key.find('/', start), key.size());
+		auto part = std::string_view(key).substr(start, end - start);
+		if (part.empty() || part == "." || part == "..")
+		{
+			return false;
+		}
+
+		start = end + 1;
+	}
+
+	return true;
+}
+
+struct _ZoneCache
+{
+	std::mutex mutex;
+	std::map<std::string, std::shared_ptr<const ZoneInfo>, std::less<>> zones;
+};
+
+static _ZoneCache& _zone_cache()
+{
+	static _ZoneCache cache;
+	return cache;
+}
+
+std::shared_ptr<const ZoneInfo> ZoneInfo::get(const std::string& key)
+{
+	auto& cache = _zone_cache();
+	std::lock_guard<std::mutex> guard(cache.mutex);
+	auto it = cache.zones.find(key);
+	if (it != cache.zones.end())
+	{
+		return it->second;
+	}
+
+	std::string data;
+	if (!_is_valid_key(key) || !_read_file(_zoneinfo_dir() + "/" + key, data))
+	{
+		throw std::invalid_argument("dt: unknown time zone '" + key + "'");
+	}
+
+	auto zone = ZoneInfo::from_tzif(key, data);
+	cache.zones.emplace(key, zone);
+	return zone;
+}
+
+static std::shared_ptr<const ZoneInfo> _load_local_zone()
+{
+	std::string data;
+	auto tz = std::getenv("TZ");
+	if (tz && *tz)
+	{
+		std::string key = tz[0] == ':' ? tz + 1 : tz;
+		if (!key.empty() && key.front() == '/')
+		{
+			if (_read_file(key, data))
+			{
+				return ZoneInfo::from_tzif(key, data);
+			}
+		}
+		else if (_is_valid_key(key))
+		{
+			try
+			{
+				return ZoneInfo::get(key);
+			}
+			catch (const std::invalid_argument&)
+			{
+			}
+		}
+
+		try
+		{
+			return ZoneInfo::from_posix_tz(key);
+		}
+		catch (const std::invalid_argument&)
+		{
+		}
+	}
+	else if (_read_file("/etc/localtime", data))
+	{
+		return ZoneInfo::from_tzif("localtime", data);
+	}
+
+	return ZoneInfo::from_posix_tz("UTC0");
+}
+
+std::shared_ptr<const ZoneInfo> ZoneInfo::local()
+{
+	static const auto zone = _load_local_zone();
+	return zone;
+}
+
+size_t ZoneInfo::cache_size()
+{
+	auto& cache = _zone_cache();
+	std::lock_guard<std::mutex> guard(cache.mutex);
+	return cache.zones.size();
+}
+
+const ZoneInfo::LocalTimeType& ZoneInfo::find_utc(int64_t seconds) const
+{
+	const auto& transitions = this->_transitions;
+	if (transitions.empty() || seconds >= transitions.back())
+	{
+		if (this->_has_footer)
+		{
+			return this->_types[this->_footer_type(seconds)];
+		}
+
+		return this->_types[transitions.empty() ? 0 : this->_transition_types.back()];
+	}
+
+	// Type 0 is used before the first transition.
+	auto it = std::upper_bound(transitions.begin(), transitions.end(), seconds);
+	if (it == transitions.begin())
+	{
+		return this->_types[0];
+	}
+
+	return this->_types[this->_transition_types[it - transitions.begin() - 1]];
+}
+
+const ZoneInfo::LocalTimeType& ZoneInfo::find_local(int64_t seconds, bool fold) const
+{
+	// Offsets are less than a day, so the types a day before and a day
+	// after are on both sides of any transition near `seconds`.
+	const auto& before = this->find_utc(seconds - 86400);
+	const auto& after = this->find_utc(seconds + 86400);
+	if (before.utc_offset == after.utc_offset)
+	{
+		return this->find_utc(seconds - before.utc_offset);
+	}
+
+	const auto& first = this->find_utc(seconds - before.utc_offset);
+	const auto& second = this->find_utc(seconds - after.utc_offset);
+	bool first_valid = first.utc_offset == before.utc_offset;
+	bool second_valid = second.utc_offset == after.utc_offset;
+	if (first_valid && second_valid)
+	{
+		return fold ? second : first;
+	}
+
+	if (first_valid || second_valid)
+	{
+		return first_valid ? first : second;
+	}
+
+	return fold ? after : before;
+}
+
+CompactDatetime ZoneInfo::to_local(const CompactDatetime& value) const
+{
+	return value.with_utc_offset(this->find_utc(_floor_div(value.microseconds(), 1000000)).utc_offset);
+}
+
+CompactDatetime ZoneInfo::localize(const DatetimeFields& fields, bool fold) const
+{
+	auto local = fields;
+	local.has_utc_offset = false;
+	auto microseconds = CompactDatetime::from_fields(local).microseconds();
+	int64_t offset = this->find_local(_floor_div(microseconds, 1000000), fold).utc_offset;
+	return CompactDatetime(microseconds - offset * 1000000, (int32_t)offset);
+}
+
+static inline int64_t _local_seconds(const Datetime* dt)
+{
+	return _days_from_civil(dt->year(), dt->month(), dt->day()) * 86400 +
+		dt->hour() * 3600 + dt->minute() * 60 + dt->second();
+}
+
+ZoneTimezone::ZoneTimezone(std::shared_ptr<const ZoneInfo> zone) :
+	Timezone(Timedelta(0), zone->key()), _zone(std::move(zone))
+{
+}
+
+ZoneTimezone::ZoneTimezone(const std::string& key) : ZoneTimezone(ZoneInfo::get(key))
+{
+}
+
+bool ZoneTimezone::_equals(const Timezone& other) const
+{
+	auto zone = dynamic_cast<const ZoneTimezone*>(&other);
+	return zone && zone->_zone == this->_zone;
+}
+
+std::shared_ptr<Timezone> ZoneTimezone::ptr_copy() const
+{
+	auto ptr = std::make_shared<ZoneTimezone>(*this);
+	return {ptr, static_cast<Timezone*>(ptr.get())};
+}
+
+std::shared_ptr<Timedelta> ZoneTimezone::utc_offset(const Datetime* dt) const
+{
+	if (!dt)
+	{
+		return nullptr;
+	}
+
+	return std::make_shared<Timedelta>(0, this->_zone->find_local(_local_seconds(dt), dt->fold()).utc_offset);
+}
+
+std::string ZoneTimezone::tz_name(const Datetime* dt) const
+{
+	if (!dt)
+	{
+		return this->_zone->key();
+	}
+
+	return this->_zone->find_local(_local_seconds(dt), dt->fold()).abbreviation;
+}
+
+std::shared_ptr<Timedelta> ZoneTimezone::dst(const Datetime* dt) const
+{
+	if (!dt)
+	{
+		return nullptr;
+	}
+
+	return std::make_shared<Timedelta>(0, this->_zone->find_local(_local_seconds(dt), dt->fold()).dst_offset);
+}
+
+Datetime ZoneTimezone::from_utc(const Datetime* dt) const
+{
+	if (!dt)
+	{
+		throw std::invalid_argument("Timezone: from_utc() argument must be instantiated");
+	}
+
+	auto tzinfo = dt->tz_info();
+	if (!tzinfo || (*tzinfo != *this))
+	{
+		throw std::invalid_argument("Timezone: dt.tz_info() is not this");
+	}
+
+	auto seconds = _local_seconds(dt);
+	auto offset = this->_zone->find_utc(seconds).utc_offset;
+
+	// The second occurrence of repeated local time has fold set.
+	bool fold = this->_zone->find_local(seconds + offset, false).utc_offset != offset;
+	auto local = *dt + Timedelta(0, offset);
+	return Datetime(
+		local.year(), local.month(), local.day(), local.hour(), local.minute(), local.second(),
+		local.microsecond(), this->ptr_copy(), fold ? 1 : 0
+	);
+}
+
+__DATETIME_END__
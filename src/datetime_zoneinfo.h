@@ -0,0 +1,206 @@
+/**
+ * datetime_zoneinfo.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Time zones from IANA time zone database.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./datetime.h"
+#include "./datetime_compact.h"
+
+
+__DATETIME_BEGIN__
+
+// Time zone rules loaded from TZif file (RFC 8536). Transitions are
+// parsed once, lookups use binary search over them and the POSIX TZ
+// rule from the file footer for times after the last transition. No
+// libc time functions are called.
+//
+// Objects are immutable and can be shared between threads.
+class ZoneInfo final
+{
+public:
+	struct LocalTimeType
+	{
+		// Offset from UTC in seconds, positive for east of UTC.
+		int32_t utc_offset = 0;
+
+		// DST part of `utc_offset` in seconds, zero for standard time.
+		int32_t dst_offset = 0;
+
+		bool is_dst = false;
+
+		// Abbreviation, for example 'EST'.
+		std::string abbreviation;
+	};
+
+private:
+	// Day of the year from POSIX TZ rule and local time of the
+	// transition in seconds.
+	struct _DateRule
+	{
+		enum class Kind
+		{
+			// 'Jn', 1 <= n <= 365, February 29 is never counted.
+			Julian,
+
+			// 'n', 0 <= n <= 365, February 29 is counted.
+			Day,
+
+			// 'Mm.w.d', d'th day of week w of month m.
+			MonthWeekDay
+		};
+
+		Kind kind = Kind::Day;
+		int day = 0;
+		int month = 0;
+		int week = 0;
+		int32_t time = 7200;
+	};
+
+	std::string _key;
+
+	// Transition times in seconds since epoch UTC, ascending, and
+	// indices of local time types which start at them.
+	std::vector<int64_t> _transitions;
+	std::vector<uint8_t> _transition_types;
+
+	// Types from the file followed by types from the footer.
+	std::vector<LocalTimeType> _types;
+
+	// Footer rule.
+	bool _has_footer = false;
+	bool _footer_has_dst = false;
+	size_t _footer_std = 0;
+	size_t _footer_dst = 0;
+	_DateRule _dst_start;
+	_DateRule _dst_end;
+
+	ZoneInfo() = default;
+
+	void _parse_tzif(std::string_view data);
+
+	[[nodiscard]]
+	bool _parse_footer(std::string_view tz);
+
+	void _compute_dst_offsets();
+
+	// Returns the index of the footer type in effect at `seconds` UTC.
+	[[nodiscard]]
+	size_t _footer_type(int64_t seconds) const;
+
+	[[nodiscard]]
+	static int64_t _rule_day(const _DateRule& rule, int year);
+
+public:
+	// Parses contents of TZif file.
+	//
+	// Throws `std::invalid_argument` if `data` is not valid.
+	static std::shared_ptr<const ZoneInfo> from_tzif(const std::string& key, std::string_view data);
+
+	// Parses POSIX TZ string, for example 'EST5EDT,M3.2.0,M11.1.0'.
+	//
+	// Throws `std::invalid_argument` if `tz` is not valid.
+	static std::shared_ptr<const ZoneInfo> from_posix_tz(const std::string& tz);
+
+	// Returns the zone named `key`, for example 'Europe/Kyiv', loaded
+	// from the directory in 'TZDIR' environment variable or from
+	// '/usr/share/zoneinfo'. Each zone is loaded once and cached.
+	//
+	// Throws `std::invalid_argument` if the zone does not exist or its
+	// file is not valid.
+	static std::shared_ptr<const ZoneInfo> get(const std::string& key);
+
+	// Returns the zone from 'TZ' environment variable or from
+	// '/etc/localtime', UTC if neither is available. It is determined
+	// once, changes of the environment made later are ignored.
+	static std::shared_ptr<const ZoneInfo> local();
+
+	// Returns the number of zones loaded by `get`.
+	static size_t cache_size();
+
+	[[nodiscard]]
+	inline const std::string& key() const
+	{
+		return this->_key;
+	}
+
+	[[nodiscard]]
+	inline const std::vector<int64_t>& transitions() const
+	{
+		return this->_transitions;
+	}
+
+	// Returns local time type in effect at `seconds` since epoch UTC.
+	[[nodiscard]]
+	const LocalTimeType& find_utc(int64_t seconds) const;
+
+	// Returns local time type of local time `seconds` since epoch.
+	//
+	// Local time repeated when clocks are turned back resolves to the
+	// type before the transition if `fold` is `false` and to the type
+	// after it otherwise. Local time skipped when clocks are turned
+	// forward resolves the other way round, as in PEP 495.
+	[[nodiscard]]
+	const LocalTimeType& find_local(int64_t seconds, bool fold=false) const;
+
+	// Returns the same instant with the UTC offset of this zone. Naive
+	// `value` is treated as UTC.
+	[[nodiscard]]
+	CompactDatetime to_local(const CompactDatetime& value) const;
+
+	// Returns local time from `fields` with the UTC offset of this
+	// zone. UTC offset in `fields` is ignored.
+	[[nodiscard]]
+	CompactDatetime localize(const DatetimeFields& fields, bool fold=false) const;
+};
+
+// `Timezone` implemented by `ZoneInfo`.
+class ZoneTimezone : public Timezone
+{
+private:
+	std::shared_ptr<const ZoneInfo> _zone;
+
+protected:
+	[[nodiscard]]
+	bool _equals(const Timezone& other) const override;
+
+public:
+	explicit ZoneTimezone(std::shared_ptr<const ZoneInfo> zone);
+
+	// Uses `ZoneInfo::get(key)`.
+	explicit ZoneTimezone(const std::string& key);
+
+	[[nodiscard]]
+	inline const ZoneInfo& zone() const
+	{
+		return *this->_zone;
+	}
+
+	[[nodiscard]]
+	std::shared_ptr<Timezone> ptr_copy() const override;
+
+	std::shared_ptr<Timedelta> utc_offset(const Datetime* dt) const override;
+
+	std::string tz_name(const Datetime* dt) const override;
+
+	std::shared_ptr<Timedelta> dst(const Datetime* dt) const override;
+
+	Datetime from_utc(const Datetime* dt) const override;
+};
+
+__DATETIME_END__
@@ -8,34 +8,142 @@
 
 // C++ libraries.
 #include <sstream>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // Base libraries.
 #include "./exceptions.h"
 #include "./string_utils.h"
 #include "./unicode/tables.h"
+#include "./unicode/utf8.h"
 
 
 __ENCODING_BEGIN__
 
 inline constexpr const char* HEX_DIGITS = "0123456789ABCDEF";
 
+// 256-bit set of bytes which are written without percent-encoding.
+struct _SafeSet
+{
+	uint64_t bits[4]{};
+
+	constexpr void add(unsigned char c)
+	{
+		this->bits[c >> 6] |= (uint64_t)1 << (c & 63);
+	}
+
+	[[nodiscard]]
+	constexpr bool contains(unsigned char c) const
+	{
+		return (this->bits[c >> 6] >> (c & 63)) & 1;
+	}
+};
+
+static constexpr _SafeSet _make_unreserved_set()
+{
+	_SafeSet set;
+	for (unsigned char c = '0'; c <= '9'; c++)
+	{
+		set.add(c);
+	}
+
+	for (unsigned char c = 'a'; c <= 'z'; c++)
+	{
+		set.add(c);
+		set.add(c - 'a' + 'A');
+	}
+
+	for (unsigned char c : {'-', '_', '.', '!', '~', '*', '\'', '(', ')'})
+	{
+		set.add(c);
+	}
+
+	return set;
+}
+
+// Unreserved characters: ALPHA NUMERIC - _ . ! ~ * ' ( )
+inline constexpr const _SafeSet UNRESERVED = _make_unreserved_set();
+
+static inline _SafeSet _make_safe_set(std::string_view safe)
+{
+	auto set = UNRESERVED;
+	for (auto c : safe)
+	{
+		set.add((unsigned char)c);
+	}
+
+	return set;
+}
+
+// Returns the length of the longest prefix of `data` which consists
+// of unreserved characters only.
+static inline size_t _unreserved_prefix(const char* data, size_t size)
+{
+	size_t i = 0;
+#if defined(__SSE2__)
+	auto in_range = [](__m128i x, char lo, char hi) -> __m128i {
+		return _mm_and_si128(
+			_mm_cmpgt_epi8(x, _mm_set1_epi8((char)(lo - 1))),
+			_mm_cmplt_epi8(x, _mm_set1_epi8((char)(hi + 1)))
+		);
+	};
+	for (; i + 16 <= size; i += 16)
+	{
+		auto x = _mm_loadu_si128((const __m128i*)(data + i));
+
+		// Bytes >= 0x80 are negative in signed comparisons,
+		// so none of the ranges below accepts them.
+		auto ok = _mm_or_si128(
+			_mm_or_si128(in_range(x, '0', '9'), in_range(_mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 'z')),
+			_mm_or_si128(
+				_mm_or_si128(in_range(x, '\'', '*'), in_range(x, '-', '.')),
+				_mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('!')), _mm_cmpeq_epi8(x, _mm_set1_epi8('_'))),
+					_mm_cmpeq_epi8(x, _mm_set1_epi8('~'))
+				)
+			)
+		);
+		auto mask = (unsigned)_mm_movemask_epi8(ok);
+		if (mask != 0xFFFF)
+		{
+			return i + __builtin_ctz(~mask);
+		}
+	}
+#endif
+	while (i < size && UNRESERVED.contains((unsigned char)data[i]))
+	{
+		i++;
+	}
+
+	return i;
+}
+
 // The maximum size table for linear search for non-Latin1 symbol.
 inline constexpr const size_t LINEAR_MAX = 18;
 
 bool _is16(const std::vector<unicode::Range16>& ranges, uint16_t r)
 {
-	if (ranges.size() <= LINEAR_MAX || r <= unicode::MAX_LATIN_1)
+	return _is16(ranges.data(), ranges.data() + ranges.size(), r);
+}
+
+bool _is16(const unicode::Range16* begin, const unicode::Range16* end, uint16_t r)
+{
+	size_t size = end - begin;
+	if (size <= LINEAR_MAX || r <= unicode::MAX_LATIN_1)
 	{
-		for (const auto& range : ranges)
+		for (auto range = begin; range != end; range++)
 		{
-			if (r < range.lo)
+			if (r < range->lo)
 			{
 				return false;
 			}
 
-			if (r <= range.hi)
+			if (r <= range->hi)
 			{
-				return range.stride == 1 || (r - range.lo) % range.stride == 0;
+				return range->stride == 1 || (r - range->lo) % range->stride == 0;
 			}
 		}
 
@@ -44,11 +152,11 @@ bool _is16(const std::vector<unicode::Range16>& ranges, uint16_t r)
 
 	// binary search over ranges
 	size_t lo = 0;
-	auto hi = ranges.size();
+	auto hi = size;
 	while (lo < hi)
 	{
 		auto m = lo + (hi - lo) / 2;
-		auto range = ranges[m];
+		const auto& range = begin[m];
 		if (range.lo <= r && r <= range.hi)
 		{
 			return range.stride == 1 || (r - range.lo) % range.stride == 0;
@@ -93,7 +201,7 @@ bool _is32(const std::vector<unicode::Range32>& ranges, uint32_t r)
 	while (lo < hi)
 	{
 		auto m = lo + (hi - lo) / 2;
-		auto range = ranges[m];
+		const auto& range = ranges[m];
 		if (range.lo <= r && r <= range.hi)
 		{
 			return range.stride == 1 || (r - range.lo) % range.stride == 0;
@@ -114,13 +222,13 @@ bool _is32(const std::vector<unicode::Range32>& ranges, uint32_t r)
 
 bool _is_excluding_latin(const unicode::RangeTable& range_table, wchar_t c)
 {
-	auto r16 = range_table.r16;
-	auto offset = range_table.latin_offset;
+	const auto& r16 = range_table.r16;
+	size_t offset = range_table.latin_offset;
 
 	// Compare as uint32 to correctly handle negative values.
-	if (r16.size() > offset && c <= r16[r16.size() - 1].hi)
+	if (r16.size() > offset && (uint32_t)c <= r16[r16.size() - 1].hi)
 	{
-		return _is16({r16.begin() + offset, r16.end()}, (uint16_t)c);
+		return _is16(r16.data() + offset, r16.data() + r16.size(), (uint16_t)c);
 	}
 
 	if (!range_table.r32.empty() && c >= range_table.r32[0].lo)
@@ -196,11 +304,7 @@ unsigned char unhex(unsigned char c)
 
 void escape_char(std::ostringstream& stream, char c, const std::string& safe)
 {
-	if ((c >= '0' && c <= '9') ||
-	    (c >= 'a' && c <= 'z') ||
-	    (c >= 'A' && c <= 'Z') ||
-	    c == '-' || c == '_' || c == '.' || c == '!' || c == '~' ||
-	    c == '*' || c == '\'' || c == '(' || c == ')' || safe.find(c) != -1)
+	if (UNRESERVED.contains((unsigned char)c) || safe.find(c) != std::string::npos)
 	{
 		stream << c;
 	}
@@ -214,107 +318,95 @@ void escape_char(std::ostringstream& stream, char c, const std::string& safe)
 
 std::string quote(const std::string& s, const std::string& safe)
 {
-	std::ostringstream oss;
-	for (const auto& c : s)
-	{
-		escape_char(oss, c, safe);
-	}
-
-	return oss.str();
+	std::string result;
+	quote_into(result, s, safe);
+	return result;
 }
 
-std::string encode_ascii(const std::string& s, Mode mode)
+void quote_into(std::string& out, std::string_view s, std::string_view safe)
 {
-	std::string res;
-	auto sz = s.size();
-	for (size_t i = 0; i < sz; i++)
+	auto safe_set = _make_safe_set(safe);
+	auto data = s.data();
+	auto size = s.size();
+
+	// Count characters which need to be escaped to size the output exactly.
+	size_t escaped = 0;
+	for (size_t i = 0; i < size; i++)
 	{
-		auto c = (unsigned char)s[i];
-		if (c > 127)
+		i += _unreserved_prefix(data + i, size - i);
+		if (i < size)
+		{
+			escaped += !safe_set.contains((unsigned char)data[i]);
+		}
+	}
+
+	auto pos = out.size();
+	out.resize(pos + size + escaped * 2);
+	auto dst = out.data() + pos;
+	for (size_t i = 0; i < size; i++)
+	{
+		auto run = _unreserved_prefix(data + i, size - i);
+		std::memcpy(dst, data + i, run);
+		dst += run;
+		i += run;
+		if (i < size)
 		{
-			switch (mode)
+			auto c = (unsigned char)data[i];
+			if (safe_set.contains(c))
 			{
-				case Mode::Strict:
-					throw EncodingError(
-						"'ascii' codec can't encode character in position " + std::to_string(i) +
-						": ordinal not in range [0;127]",
-						_ERROR_DETAILS_
-					);
-				case Mode::Ignore:
-					continue;
-				case Mode::Replace:
-					res += '?';
-					continue;
+				*dst++ = (char)c;
+			}
+			else
+			{
+				*dst++ = '%';
+				*dst++ = HEX_DIGITS[c >> 4];
+				*dst++ = HEX_DIGITS[c & 0x0F];
 			}
 		}
-
-		res += c;
 	}
-
-	return res;
 }
 
-std::string encode_iso_8859_1(const std::string& s, Mode mode)
+std::string unquote(std::string_view s)
 {
-	if (s.empty())
+	auto pos = s.find('%');
+	if (pos == std::string_view::npos)
 	{
-		return s;
+		return std::string(s);
 	}
 
-	std::string out;
-	auto in = s.begin();
-	unsigned int codepoint;
-	while (*in != 0)
+	std::string result(s.size(), '\0');
+	std::memcpy(result.data(), s.data(), pos);
+	auto size = s.size();
+	size_t j = pos;
+	for (size_t i = pos; i < size;)
 	{
-		auto ch = static_cast<unsigned char>(*in);
-		if (ch <= 0x7f)
-		{
-			codepoint = ch;
-		}
-		else if (ch <= 0xbf)
-		{
-			codepoint = (codepoint << 6) | (ch & 0x3f);
-		}
-		else if (ch <= 0xdf)
+		if (s[i] == '%' && i + 2 < size && is_hex(s[i + 1]) && is_hex(s[i + 2]))
 		{
-			codepoint = ch & 0x1f;
-		}
-		else if (ch <= 0xef)
-		{
-			codepoint = ch & 0x0f;
+			result[j++] = (char)(unhex(s[i + 1]) << 4 | unhex(s[i + 2]));
+			i += 3;
 		}
 		else
 		{
-			codepoint = ch & 0x07;
-		}
-
-		++in;
-		if (((*in & 0xc0) != 0x80) && (codepoint <= 0x10ffff))
-		{
-			if (codepoint <= 255)
-			{
-				out.append(1, static_cast<char>(codepoint));
-			}
-			else
-			{
-				switch (mode)
-				{
-					case Mode::Strict:
-						throw EncodingError(
-							"'iso_8859_1' codec can't encode character: ordinal not in range [0;255]",
-							_ERROR_DETAILS_
-						);
-					case Mode::Ignore:
-						break;
-					case Mode::Replace:
-						out += '?';
-						break;
-				}
-			}
+			result[j++] = s[i++];
 		}
 	}
 
-	return out;
+	result.resize(j);
+	return result;
+}
+
+std::string encode_ascii(const std::string& s, Mode mode)
+{
+	std::string result;
+	Encoder(Encoding::ASCII, mode).convert(s, result, true);
+	return result;
+}
+
+std::string encode_iso_8859_1(const std::string& s, Mode mode)
+{
+	std::string result;
+	Encoder(Encoding::ISO_8859_1, mode).convert(s, result, true);
+	return result;
 }
 
 std::string encode_utf_8(const std::string& s, Mode /* mode */)
@@ -346,6 +438,272 @@ std::string encode(const std::string& s, Encoding enc, Mode mode)
 	return result;
 }
 
+static inline const char* _codec_name(Encoding encoding)
+{
+	switch (encoding)
+	{
+		case Encoding::ASCII:
+			return "ascii";
+		case Encoding::Latin_1:
+		case Encoding::ISO_8859_1:
+			return "iso_8859_1";
+		case Encoding::Utf_8:
+			return "utf_8";
+		default:
+			throw EncodingError("unknown encoding", _ERROR_DETAILS_);
+	}
+}
+
+// UTF-8 encoded U+FFFD.
+inline constexpr const std::string_view UTF_8_REPLACEMENT = "\xEF\xBF\xBD";
+
+void Transcoder::_throw(size_t position, const char* reason) const
+{
+	throw EncodingError(
+		std::string("'") + _codec_name(this->_encoding) + "' codec can't " + this->_action +
+		" character in position " + std::to_string(position) + ": " + reason,
+		_ERROR_DETAILS_
+	);
+}
+
+template <typename KernelT>
+size_t Transcoder::_convert_utf8_step(
+	std::string_view& in, char* out, bool final, std::string_view replacement, KernelT kernel
+)
+{
+	size_t written = 0;
+	while (!in.empty())
+	{
+		auto result = kernel(in, out + written);
+		if (result.ok())
+		{
+			written += result.count;
+			this->_position += in.size();
+			in = {};
+			break;
+		}
+
+		// The prefix before the error is valid, convert it again to
+		// get the number of written bytes.
+		written += kernel(in.substr(0, result.count), out + written).count;
+		this->_position += result.count;
+		in.remove_prefix(result.count);
+		if (result.error == unicode::utf8::Error::Truncated && !final)
+		{
+			break;
+		}
+
+		if (this->_mode == Mode::Strict)
+		{
+			this->_throw(
+				this->_position,
+				result.error == unicode::utf8::Error::OutOfRange ? "ordinal not in range [0;255]" : "invalid UTF-8 sequence"
+			);
+		}
+
+		if (this->_mode == Mode::Replace)
+		{
+			std::memcpy(out + written, replacement.data(), replacement.size());
+			written += replacement.size();
+		}
+
+		// Skip the whole code point if it is valid but out of range,
+		// the incomplete sequence at the end of input, or the single
+		// offending byte otherwise.
+		size_t width = 1;
+		if (result.error == unicode::utf8::Error::OutOfRange)
+		{
+			auto c = (unsigned char)in[0];
+			width = c >= 0xF0 ? 4 : (c >= 0xE0 ? 3 : 2);
+		}
+		else if (result.error == unicode::utf8::Error::Truncated)
+		{
+			width = in.size();
+		}
+
+		this->_position += width;
+		in.remove_prefix(width);
+	}
+
+	return written;
+}
+
+template <typename KernelT>
+size_t Transcoder::_convert_utf8(
+	const char* data, size_t size, char* out, bool final, std::string_view replacement, KernelT kernel
+)
+{
+	size_t written = 0;
+	if (this->_pending_size)
+	{
+		// Complete the pending sequence, then convert it separately
+		// from the rest of the input.
+		auto lead = (unsigned char)this->_pending[0];
+		size_t width = lead >= 0xF0 ? 4 : (lead >= 0xE0 ? 3 : 2);
+		auto take = std::min(width - this->_pending_size, size);
+		std::memcpy(this->_pending + this->_pending_size, data, take);
+		this->_pending_size += take;
+		data += take;
+		size -= take;
+
+		std::string_view pending(this->_pending, this->_pending_size);
+		written += this->_convert_utf8_step(pending, out, final || size > 0, replacement, kernel);
+		std::memmove(this->_pending, pending.data(), pending.size());
+		this->_pending_size = pending.size();
+		if (this->_pending_size)
+		{
+			return written;
+		}
+	}
+
+	std::string_view in(data, size);
+	written += this->_convert_utf8_step(in, out + written, final, replacement, kernel);
+
+	// Only an incomplete sequence of at most 3 bytes can be left.
+	std::memcpy(this->_pending, in.data(), in.size());
+	this->_pending_size = in.size();
+	return written;
+}
+
+size_t Transcoder::_convert_ascii(const char* data, size_t size, char* out, std::string_view replacement)
+{
+	auto begin = out;
+	for (size_t i = 0; i < size; i++)
+	{
+		auto c = (unsigned char)data[i];
+		if (c > 127)
+		{
+			switch (this->_mode)
+			{
+				case Mode::Strict:
+					this->_position += i;
+					this->_throw(this->_position, "ordinal not in range [0;127]");
+				case Mode::Ignore:
+					continue;
+				case Mode::Replace:
+					std::memcpy(out, replacement.data(), replacement.size());
+					out += replacement.size();
+					continue;
+			}
+		}
+
+		*out++ = (char)c;
+	}
+
+	this->_position += size;
+	return out - begin;
+}
+
+void Transcoder::convert(std::string_view chunk, std::string& out, bool final)
+{
+	auto pos = out.size();
+	out.resize(pos + this->max_output_size(chunk.size()));
+	out.resize(pos + this->convert(chunk.data(), chunk.size(), out.data() + pos, final));
+}
+
+size_t Encoder::max_output_size(size_t size) const
+{
+	// Replacement is never longer than replaced sequence.
+	return size + this->_pending_size;
+}
+
+size_t Encoder::convert(const char* data, size_t size, char* out, bool final)
+{
+	switch (this->_encoding)
+	{
+		case Encoding::ASCII:
+			return this->_convert_ascii(data, size, out, "?");
+		case Encoding::Latin_1:
+		case Encoding::ISO_8859_1:
+			return this->_convert_utf8(data, size, out, final, "?", unicode::utf8::utf8_to_latin1);
+		case Encoding::Utf_8:
+			// !IMPORTANT!
+			// The same as 'encode_utf_8(...)', the input is copied as is.
+			std::memcpy(out, data, size);
+			this->_position += size;
+			return size;
+		default:
+			throw EncodingError("unknown encoding", _ERROR_DETAILS_);
+	}
+}
+
+size_t Decoder::max_output_size(size_t size) const
+{
+	// Each byte can be replaced by U+FFFD or encoded by two bytes.
+	return (size + this->_pending_size) * UTF_8_REPLACEMENT.size();
+}
+
+size_t Decoder::convert(const char* data, size_t size, char* out, bool final)
+{
+	switch (this->_encoding)
+	{
+		case Encoding::ASCII:
+			return this->_convert_ascii(data, size, out, UTF_8_REPLACEMENT);
+		case Encoding::Latin_1:
+		case Encoding::ISO_8859_1:
+			this->_position += size;
+			return unicode::utf8::latin1_to_utf8({data, size}, out).count;
+		case Encoding::Utf_8:
+			return this->_convert_utf8(
+				data, size, out, final, UTF_8_REPLACEMENT, [](std::string_view in, char* out) {
+					auto result = unicode::utf8::validate_utf8(in);
+					std::memcpy(out, in.data(), result.count);
+					return result;
+				}
+			);
+		default:
+			throw EncodingError("unknown encoding", _ERROR_DETAILS_);
+	}
+}
+
+ssize_t TranscodingReader::_convert(ssize_t result, std::string& buffer)
+{
+	buffer.clear();
+	if (result < 0)
+	{
+		return result;
+	}
+
+	this->_transcoder->convert(this->_chunk, buffer, result == 0);
+	return result;
+}
+
+ssize_t TranscodingReader::read_line(std::string& buffer)
+{
+	this->_chunk.clear();
+	auto result = this->_reader->read_line(this->_chunk);
+	return this->_convert(result, buffer);
+}
+
+ssize_t TranscodingReader::read(std::string& buffer, size_t max_count)
+{
+	this->_chunk.clear();
+	auto result = this->_reader->read(this->_chunk, max_count);
+	return this->_convert(result, buffer);
+}
+
+ssize_t TranscodingWriter::_write(const char* buffer, size_t count, bool final)
+{
+	this->_chunk.clear();
+	this->_transcoder->convert({buffer, count}, this->_chunk, final);
+	if (!this->_chunk.empty())
+	{
+		auto result = this->_writer->write(this->_chunk.data(), this->_chunk.size());
+		if (result < 0)
+		{
+			return result;
+		}
+	}
+
+	return (ssize_t)count;
+}
+
+bool TranscodingWriter::close_writer()
+{
+	auto result = this->_write("", 0, true);
+	return this->_writer->close_writer() && result >= 0;
+}
+
 std::tuple<std::wstring, bool> decode2231(const std::wstring& s)
 {
 	auto sv = str::split(s, '\'', 3);
@@ -373,58 +731,102 @@ std::tuple<std::wstring, bool> decode2231(const std::wstring& s)
 	return {str::string_to_wstring(unescaped_string), true};
 }
 
-std::string percent_hex_unescape(std::string s)
+// Decodes percent-encoded sequence in place. On success `size` is set to
+// the decoded size, otherwise it is set to the position of bogus '%'; the
+// input after this position is left untouched.
+static inline bool _percent_decode_in_place(char* data, size_t& size, bool plus_as_space)
 {
-	// Count %, check that they're well-formed.
-	size_t percents = 0;
-	for (size_t i = 0; i < s.size();)
+	// Skip the prefix which does not need decoding.
+	size_t i = 0;
+	while (i < size && data[i] != '%' && !(plus_as_space && data[i] == '+'))
 	{
-		if (s[i] != '%')
-		{
-			i++;
-			continue;
-		}
+		i++;
+	}
 
-		percents++;
-		if (i + 2 >= s.size() || !is_hex(s[i + 1]) || !is_hex(s[i + 2]))
+	size_t j = i;
+	while (i < size)
+	{
+		auto c = data[i];
+		if (c == '%')
 		{
-			s = s.substr(i);
-			if (s.size() > 3)
+			if (i + 2 >= size || !is_hex(data[i + 1]) || !is_hex(data[i + 2]))
 			{
-				s = s.substr(0, 3);
+				size = i;
+				return false;
 			}
 
-			throw ValueError("mime: bogus characters after %: " + s, _ERROR_DETAILS_);
+			data[j++] = (char)(unhex(data[i + 1]) << 4 | unhex(data[i + 2]));
+			i += 3;
+		}
+		else
+		{
+			data[j++] = plus_as_space && c == '+' ? ' ' : c;
+			i++;
 		}
-
-		i += 3;
 	}
 
-	if (percents == 0)
+	size = j;
+	return true;
+}
+
+std::string percent_hex_unescape(std::string s)
+{
+	auto size = s.size();
+	if (!_percent_decode_in_place(s.data(), size, false))
 	{
-		return s;
+		throw ValueError("mime: bogus characters after %: " + s.substr(size, 3), _ERROR_DETAILS_);
 	}
 
-	std::string result;
-	size_t j = 0;
-	auto s_size = s.size();
-	for (size_t i = 0; i < s_size;)
-	{
-		switch (s[i]) {
-			case '%':
-				result[j] = unhex(s[i + 1] << 4 | unhex(s[i + 2]));
-				j++;
-				i += 3;
-				break;
-			default:
-				result[j] = s[i];
-				j++;
-				i++;
-				break;
+	s.resize(size);
+	return s;
+}
+
+size_t percent_decode_in_place(char* data, size_t size, bool plus_as_space)
+{
+	return _percent_decode_in_place(data, size, plus_as_space) ? size : std::string::npos;
+}
+
+void parse_query(
+	char* data, size_t size, const std::function<void(std::string_view, std::string_view)>& func
+)
+{
+	auto end = data + size;
+	auto begin = data;
+	while (begin < end)
+	{
+		auto amp = (char*)std::memchr(begin, '&', end - begin);
+		auto pair_end = amp ? amp : end;
+		if (pair_end != begin)
+		{
+			auto eq = (char*)std::memchr(begin, '=', pair_end - begin);
+			auto key_end = eq ? eq : pair_end;
+			auto key_size = percent_decode_in_place(begin, key_end - begin, true);
+			if (key_size != std::string::npos)
+			{
+				size_t value_size = 0;
+				if (eq)
+				{
+					value_size = percent_decode_in_place(eq + 1, pair_end - eq - 1, true);
+				}
+
+				if (value_size != std::string::npos)
+				{
+					func({begin, key_size}, {eq ? eq + 1 : pair_end, value_size});
+				}
+			}
 		}
+
+		begin = pair_end + 1;
 	}
+}
 
-	return result;
+void parse_query(
+	std::string& query, collections::Multimap<std::string_view, std::string_view>& result
+)
+{
+	parse_query(query.data(), query.size(), [&result](auto key, auto value) {
+		result.add(key, value);
+	});
 }
 
 __ENCODING_END__
@@ -10,14 +10,19 @@
 
 // C++ libraries.
 #include <string>
+#include <string_view>
 #include <vector>
 #include <tuple>
+#include <functional>
+#include <memory>
 
 // Module definitions.
 #include "./_def_.h"
 
 // Base libraries.
 #include "./unicode/_def_.h"
+#include "./collections/multimap.h"
+#include "./io.h"
 
 
 __ENCODING_BEGIN__
@@ -28,6 +33,9 @@ __ENCODING_BEGIN__
 // The original implementation is in Golang 1.15.8: unicode/letter.go
 extern bool _is16(const std::vector<unicode::Range16>& ranges, uint16_t r);
 
+// Reports whether r is in the sorted range [begin; end) of 16-bit ranges.
+extern bool _is16(const unicode::Range16* begin, const unicode::Range16* end, uint16_t r);
+
 // TESTME: _is32
 // Reports whether r is in the sorted slice of 32-bit ranges.
 //
@@ -67,12 +75,27 @@ extern unsigned char unhex(unsigned char c);
 // `safe`: characters which should be ignored.
 extern void escape_char(std::ostringstream& stream, char c, const std::string& safe="");
 
-// Encodes string to hex using `escape_char(...)`.
+// Encodes string to hex, the same way as `escape_char(...)` does
+// for each character.
 //
 // `s`: input string.
 // `safe`: characters which should be ignored.
 extern std::string quote(const std::string& s, const std::string& safe="");
 
+// Percent-encodes `s` and appends the result to `out`. The output is
+// sized exactly once, so the buffer is not reallocated while encoding.
+//
+// `out`: target buffer, its content is preserved.
+// `s`: input string.
+// `safe`: characters which should be ignored.
+extern void quote_into(std::string& out, std::string_view s, std::string_view safe="");
+
+// Decodes '%XY' sequences of percent-encoded string. Malformed
+// sequences are copied to the result as is.
+//
+// `s`: percent-encoded string.
+extern std::string unquote(std::string_view s);
+
 // Supported encodings.
 enum class Encoding
 {
@@ -121,16 +144,226 @@ extern std::string encode_utf_8(const std::string& s, Mode mode);
 // Returns encoded copy input string.
 extern std::string encode(const std::string& s, Encoding enc, Mode mode=Mode::Strict);
 
+// Incremental converter which accepts input split at arbitrary
+// boundaries. An incomplete multibyte sequence at the end of a chunk
+// is kept and completed by the next call.
+class Transcoder
+{
+protected:
+	Encoding _encoding;
+	Mode _mode;
+
+	// Either "encode" or "decode", used in error messages.
+	const char* _action;
+
+	// Incomplete multibyte sequence from the previous chunk.
+	char _pending[4]{};
+	size_t _pending_size = 0;
+
+	// Number of input bytes processed so far, used in error messages.
+	size_t _position = 0;
+
+	// Converts UTF-8 input with `kernel`, handling errors according to
+	// the mode. If `final` is `false`, an incomplete sequence at the end
+	// of input is left in `in`, otherwise `in` is fully consumed.
+	template <typename KernelT>
+	size_t _convert_utf8_step(
+		std::string_view& in, char* out, bool final, std::string_view replacement, KernelT kernel
+	);
+
+	// Completes the pending sequence from `data` and then converts
+	// the rest of the input with `kernel`.
+	template <typename KernelT>
+	size_t _convert_utf8(
+		const char* data, size_t size, char* out, bool final, std::string_view replacement, KernelT kernel
+	);
+
+	// Converts single-byte input, bytes greater than 127 are
+	// handled according to the mode.
+	size_t _convert_ascii(const char* data, size_t size, char* out, std::string_view replacement);
+
+	// Throws `EncodingError` for the input at `position`.
+	[[noreturn]]
+	void _throw(size_t position, const char* reason) const;
+
+	inline Transcoder(Encoding encoding, Mode mode, const char* action) :
+		_encoding(encoding), _mode(mode), _action(action)
+	{
+	}
+
+public:
+	virtual ~Transcoder() = default;
+
+	// Returns the maximum number of bytes which `convert(...)` can
+	// write for `size` bytes of input.
+	[[nodiscard]]
+	virtual size_t max_output_size(size_t size) const = 0;
+
+	// Converts a chunk of input and writes the result to `out`, which
+	// must have at least `max_output_size(size)` bytes.
+	//
+	// `final`: marks the last chunk, pending incomplete sequence is
+	// treated as invalid.
+	//
+	// Returns the number of written bytes.
+	virtual size_t convert(const char* data, size_t size, char* out, bool final) = 0;
+
+	// Converts a chunk of input and appends the result to `out`.
+	void convert(std::string_view chunk, std::string& out, bool final=false);
+
+	// Drops pending incomplete sequence.
+	inline void reset()
+	{
+		this->_pending_size = 0;
+		this->_position = 0;
+	}
+};
+
+// Incremental encoder of UTF-8 input to the given encoding. The
+// result of encoding a sequence of chunks is the same as the result
+// of `encode(...)` called for all input at once.
+class Encoder final : public Transcoder
+{
+public:
+	inline explicit Encoder(Encoding encoding, Mode mode=Mode::Strict) : Transcoder(encoding, mode, "encode")
+	{
+	}
+
+	[[nodiscard]]
+	size_t max_output_size(size_t size) const override;
+
+	size_t convert(const char* data, size_t size, char* out, bool final) override;
+
+	using Transcoder::convert;
+};
+
+// Incremental decoder of the given encoding to UTF-8. UTF-8 input is
+// validated. In `Mode::Replace` offending bytes are replaced by U+FFFD.
+class Decoder final : public Transcoder
+{
+public:
+	inline explicit Decoder(Encoding encoding, Mode mode=Mode::Strict) : Transcoder(encoding, mode, "decode")
+	{
+	}
+
+	[[nodiscard]]
+	size_t max_output_size(size_t size) const override;
+
+	size_t convert(const char* data, size_t size, char* out, bool final) override;
+
+	using Transcoder::convert;
+};
+
+// Reader which converts data from the underlying reader
+// with the given transcoder.
+class TranscodingReader : public io::IReader
+{
+protected:
+	std::shared_ptr<io::IReader> _reader;
+	std::unique_ptr<Transcoder> _transcoder;
+	std::string _chunk;
+
+	ssize_t _convert(ssize_t result, std::string& buffer);
+
+public:
+	inline TranscodingReader(std::shared_ptr<io::IReader> reader, std::unique_ptr<Transcoder> transcoder) :
+		_reader(std::move(reader)), _transcoder(std::move(transcoder))
+	{
+	}
+
+	// Reads a line from the underlying reader and writes converted
+	// line to `buffer`.
+	//
+	// Returns the result of the underlying reader.
+	ssize_t read_line(std::string& buffer) override;
+
+	// Reads `max_count` or less bytes from the underlying reader and
+	// writes converted bytes to `buffer`. The size of converted data
+	// may differ from the number of bytes read.
+	//
+	// Returns the result of the underlying reader.
+	ssize_t read(std::string& buffer, size_t max_count) override;
+
+	inline bool close_reader() override
+	{
+		return this->_reader->close_reader();
+	}
+};
+
+// Writer which converts data with the given transcoder before
+// writing it to the underlying writer.
+class TranscodingWriter : public io::IWriter
+{
+protected:
+	std::shared_ptr<io::IWriter> _writer;
+	std::unique_ptr<Transcoder> _transcoder;
+	std::string _chunk;
+
+	ssize_t _write(const char* buffer, size_t count, bool final);
+
+public:
+	inline TranscodingWriter(std::shared_ptr<io::IWriter> writer, std::unique_ptr<Transcoder> transcoder) :
+		_writer(std::move(writer)), _transcoder(std::move(transcoder))
+	{
+	}
+
+	// Converts `count` bytes and writes the result to the underlying writer.
+	//
+	// Returns `count` on success or the result of the underlying
+	// writer if it is negative.
+	inline ssize_t write(const char* buffer, size_t count) override
+	{
+		return this->_write(buffer, count, false);
+	}
+
+	// Flushes pending incomplete sequence and closes the underlying writer.
+	bool close_writer() override;
+};
+
 // TESTME: decode2231
 // TODO: docs for 'decode2231'
 //
 // The original implementation is in Golang 1.15.8: mime/mediatype.go
 extern std::tuple<std::wstring, bool> decode2231(const std::wstring& s);
 
-// TESTME: percent_hex_unescape
-// TODO: docs for 'percent_hex_unescape'
+// Decodes '%XY' sequences of percent-encoded string.
+// Throws `ValueError` if '%' is not followed by two hex digits.
 //
 // The original implementation is in Golang 1.15.8: mime/mediatype.go
 extern std::string percent_hex_unescape(std::string s);
 
+// Decodes percent-encoded sequence of chars in place. The decoded
+// sequence is never longer than the input one, so it is written
+// from the beginning of `data`.
+//
+// `data`: pointer to the first char of the sequence.
+// `size`: size of the sequence.
+// `plus_as_space`: decode '+' as ' ', used in query strings.
+//
+// Returns the size of decoded sequence or `std::string::npos` if
+// '%' is not followed by two hex digits.
+extern size_t percent_decode_in_place(char* data, size_t size, bool plus_as_space=false);
+
+// Parses `application/x-www-form-urlencoded` data, pairs are
+// separated by '&'. Keys and values are decoded in place, within
+// their own bounds in `data`, so the content of `data` is changed.
+// Pairs which can not be decoded are skipped.
+//
+// `data`: pointer to the first char of the query.
+// `size`: size of the query.
+// `func`: receives views of decoded key and value; views are valid
+// while `data` is.
+extern void parse_query(
+	char* data, size_t size, const std::function<void(std::string_view, std::string_view)>& func
+);
+
+// Parses `application/x-www-form-urlencoded` data into multimap.
+//
+// `query`: encoded query, it is decoded in place and must
+// outlive the `result`.
+// `result`: target map of views into `query`.
+extern void parse_query(
+	std::string& query, collections::Multimap<std::string_view, std::string_view>& result
+);
+
 __ENCODING_END__
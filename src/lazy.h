@@ -9,7 +9,13 @@
 #pragma once
 
 // C++ libraries.
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 
 // Module definitions.
 #include "./_def_.h"
@@ -17,6 +23,8 @@
 
 __MAIN_NAMESPACE_BEGIN__
 
+// Value initialized on the first access. Not thread-safe: use
+// `ConcurrentLazy` for values shared between threads.
 template <typename T, typename ...Args>
 class Lazy final
 {
@@ -75,6 +83,128 @@ public:
 	}
 };
 
+// Value initialized on the first access from any thread. The
+// initializer runs once even if several threads call `get` at the same
+// time; others wait for it to finish. After that `get` is a single
+// atomic load. If the initializer throws, the exception is passed to
+// the caller and the next call of `get` runs the initializer again.
+//
+// The value is constructed in place by the result of the initializer,
+// so `T` does not need default constructor.
+template <typename T>
+class ConcurrentLazy final
+{
+private:
+	mutable std::once_flag _once;
+	mutable std::atomic<bool> _loaded = false;
+	mutable std::optional<T> _value;
+	std::function<T()> _initializer;
+
+	inline void _load() const
+	{
+		std::call_once(this->_once, [this]()
+		{
+			this->_value.emplace(this->_initializer());
+			this->_loaded.store(true, std::memory_order_release);
+		});
+	}
+
+public:
+
+	// Constructs initializer.
+	//
+	// `lambda`: initializer of value.
+	//
+	// Throws `std::runtime_error` if lambda is null.
+	inline explicit ConcurrentLazy(std::function<T()> lambda) : _initializer(std::move(lambda))
+	{
+		if (!this->_initializer)
+		{
+			throw std::runtime_error("lambda function for lazy initialization is required but not set");
+		}
+	}
+
+	ConcurrentLazy(const ConcurrentLazy&) = delete;
+
+	ConcurrentLazy& operator= (const ConcurrentLazy&) = delete;
+
+	// Initializes value if it was not done yet and
+	// returns an address to initialized value.
+	explicit operator const T& () const
+	{
+		return this->get();
+	}
+
+	// Initializes value if it was not done yet and
+	// returns an address to initialized value.
+	inline const T& get() const
+	{
+		if (!this->_loaded.load(std::memory_order_acquire))
+		{
+			this->_load();
+		}
+
+		return *this->_value;
+	}
+
+	[[nodiscard]]
+	inline bool is_loaded() const
+	{
+		return this->_loaded.load(std::memory_order_acquire);
+	}
+};
+
+// Value initialized in background. The initializer starts on a worker
+// thread when the object is constructed, and `get` waits for it to
+// finish. Exception of the initializer is thrown from `get`.
+template <typename T>
+class AsyncLazy final
+{
+private:
+	std::shared_future<T> _future;
+
+public:
+
+	// Starts initializer.
+	//
+	// `lambda`: initializer of value.
+	// `policy`: `std::launch::deferred` runs the initializer in the
+	// first call of `get` instead of a worker thread.
+	//
+	// Throws `std::runtime_error` if lambda is null.
+	inline explicit AsyncLazy(std::function<T()> lambda, std::launch policy=std::launch::async)
+	{
+		if (!lambda)
+		{
+			throw std::runtime_error("lambda function for lazy initialization is required but not set");
+		}
+
+		this->_future = std::async(policy, std::move(lambda)).share();
+	}
+
+	// Returns future of the value, which can be copied and waited on
+	// from several threads.
+	[[nodiscard]]
+	inline std::shared_future<T> future() const
+	{
+		return this->_future;
+	}
+
+	// Waits for initialization and returns an address to initialized
+	// value.
+	inline const T& get() const
+	{
+		return this->_future.get();
+	}
+
+	// Returns `true` if initialization is finished.
+	[[nodiscard]]
+	inline bool is_ready() const
+	{
+		return this->_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}
+};
+
 template <typename LazyT, typename T>
 concept lazy_type = std::is_same_v<LazyT, Lazy<T>>;
 
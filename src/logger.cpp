@@ -10,7 +10,7 @@
 #include <cstring>
 
 // Base libraries.
-#include "./datetime.h"
+#include "./datetime_format.h"
 
 
 __LOG_BEGIN__
@@ -37,7 +37,8 @@ Logger::Logger(Config cfg) : config(std::move(cfg))
 		std::string result;
 		if (task.level.operator!=(Level::Trace))
 		{
-			result = "[" + dt::Datetime::now().strftime("%F %T") + "] ";
+			static const dt::Formatter formatter("[%F %T] ");
+			result = formatter.format(dt::Datetime::now());
 		}
 
 		result += "[" + level_data.name + "]:" + full_message;
@@ -6,16 +6,22 @@
 
 #include "./meta.h"
 
+// C++ libraries.
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <typeindex>
+#include <unordered_map>
+
 // Base libraries.
-#include "./object.h"
 #include "../string_utils.h"
 
 
 __OBJ_META_BEGIN__
 
-Type::Type(const Object& obj)
+Type::Type(size_t id, const std::type_info& info) : _id(id)
 {
-	std::string s = demangle(typeid(obj).name());
+	std::string s = demangle(info.name());
 	auto full_name = str::rsplit(s, ':', 1);
 	if (full_name.size() == 2)
 	{
@@ -26,4 +32,47 @@ Type::Type(const Object& obj)
 	this->_name = *(full_name.end() - 1);
 }
 
+struct _TypeRegistry
+{
+	std::shared_mutex mutex;
+	std::unordered_map<std::type_index, std::unique_ptr<const Type>> types;
+
+	// Taken only by types which are inserted, so ids are unique even if
+	// creating a record throws.
+	size_t next_id = 1;
+};
+
+// Constructed on first use, so types can be registered while
+// initializing global variables.
+static _TypeRegistry& _registry()
+{
+	static _TypeRegistry registry;
+	return registry;
+}
+
+const Type& Type::of(const std::type_info& info)
+{
+	auto& registry = _registry();
+	auto key = std::type_index(info);
+	{
+		std::shared_lock<std::shared_mutex> lock(registry.mutex);
+		auto it = registry.types.find(key);
+		if (it != registry.types.end())
+		{
+			return *it->second;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(registry.mutex);
+	auto it = registry.types.find(key);
+	if (it == registry.types.end())
+	{
+		std::unique_ptr<const Type> type(new Type(registry.next_id, info));
+		it = registry.types.emplace(key, std::move(type)).first;
+		registry.next_id++;
+	}
+
+	return *it->second;
+}
+
 __OBJ_META_END__
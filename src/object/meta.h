@@ -10,6 +10,7 @@
 
 // C++ libraries
 #include <string>
+#include <typeinfo>
 
 // Module definitions.
 #include "./_def_.h"
@@ -18,37 +19,43 @@
 #include "../utility.h"
 
 
-__OBJ_BEGIN__
-
-class Object;
-
-__OBJ_END__
-
-
 __OBJ_META_BEGIN__
 
+// Immutable metadata of a dynamic type. There is one record per type
+// for the lifetime of the program, so it is computed once and can be
+// referenced and compared cheaply.
 class Type final
 {
 private:
-	friend class xw::obj::Object;
-
-private:
+	size_t _id;
 	std::string _name;
 	std::string _namespace;
 
-	// Splits name and namespace of the object into `_name` and
-	// `_namespace`.
-	explicit Type(const Object& obj);
+	// Splits demangled name of `info` into `_name` and `_namespace`.
+	Type(size_t id, const std::type_info& info);
 
 public:
+	// Returns the record of `info`, which is created on the first call.
+	// Thread-safe.
+	static const Type& of(const std::type_info& info);
+
+	// Returns a small number unique for each type, starting from 1.
+	// Numbers are assigned in order of the first use, so they differ
+	// between runs and must not be stored.
 	[[nodiscard]]
-	inline std::string name() const
+	inline size_t id() const
+	{
+		return this->_id;
+	}
+
+	[[nodiscard]]
+	inline const std::string& name() const
 	{
 		return this->_name;
 	}
 
 	[[nodiscard]]
-	inline std::string namespace_() const
+	inline const std::string& namespace_() const
 	{
 		return this->_namespace;
 	}
@@ -56,7 +63,7 @@ public:
 	// Compares `Type` objects by name.
 	inline bool operator==(const Type& other) const
 	{
-		return this->_name == other._name;
+		return this->_id == other._id || this->_name == other._name;
 	}
 
 	// Formats and writes to stream `Type` object.
@@ -66,6 +73,22 @@ public:
 	}
 };
 
+// Returns the record of `T`, looked up once per type.
+template<typename T>
+inline const Type& type_of()
+{
+	static const Type& type = Type::of(typeid(T));
+	return type;
+}
+
+// Returns `Type::id` of `T`, for dispatching on the result of
+// `Object::__type__`.
+template<typename T>
+inline size_t type_id()
+{
+	return type_of<T>().id();
+}
+
 // Retrieves a full name of any type including namespace.
 template<typename T>
 inline std::string type_name()
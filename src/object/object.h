@@ -66,11 +66,12 @@ public:
 		return false;
 	}
 
-	// Returns basic meta information about the object.
+	// Returns basic meta information about the dynamic type of the
+	// object. The record is computed once per type.
 	[[nodiscard]]
-	inline meta::Type __type__() const
+	inline const meta::Type& __type__() const
 	{
-		return meta::Type(*this);
+		return meta::Type::of(typeid(*this));
 	}
 
 	// Default string representation of an object.
@@ -10,9 +10,14 @@
 #pragma once
 
 // C++ libraries.
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <exception>
+#include <vector>
 
 // Module definitions.
 #include "./_def_.h"
@@ -23,6 +28,166 @@
 
 __MAIN_NAMESPACE_BEGIN__
 
+// Immutable snapshot of `Options` for reading on hot paths. Keys are
+// kept in a vector sorted by key, so a lookup is a binary search over
+// contiguous memory without allocations, and numbers are parsed once
+// on construction, so `get` of numeric type does not parse anything.
+//
+// Values returned by `get` are the same as of `Options::get` for the
+// same key.
+class FrozenOptions final
+{
+private:
+	struct Entry
+	{
+		std::string key;
+		std::string value;
+
+		std::optional<long long> signed_value;
+		std::optional<unsigned long long> unsigned_value;
+		std::optional<float> float_value;
+		std::optional<double> double_value;
+	};
+
+	std::vector<Entry> _entries;
+
+	[[nodiscard]]
+	inline const Entry* _find(std::string_view key) const
+	{
+		auto it = std::lower_bound(
+			this->_entries.begin(), this->_entries.end(), key,
+			[](const Entry& entry, std::string_view k) -> bool { return entry.key < k; }
+		);
+		return it != this->_entries.end() && it->key == key ? &*it : nullptr;
+	}
+
+	// Returns parsed value of integral type `T` if it fits `T`.
+	template <typename T>
+	[[nodiscard]]
+	static inline std::optional<T> _integer(const Entry& entry)
+	{
+		if constexpr (std::is_signed_v<T>)
+		{
+			if (
+				entry.signed_value &&
+				*entry.signed_value >= (long long)std::numeric_limits<T>::min() &&
+				*entry.signed_value <= (long long)std::numeric_limits<T>::max()
+			)
+			{
+				return (T)*entry.signed_value;
+			}
+		}
+		else if (
+			entry.unsigned_value &&
+			*entry.unsigned_value <= (unsigned long long)std::numeric_limits<T>::max()
+		)
+		{
+			return (T)*entry.unsigned_value;
+		}
+
+		return std::nullopt;
+	}
+
+public:
+	FrozenOptions() = default;
+
+	// Copies `src` and parses its values.
+	explicit FrozenOptions(const std::map<std::string, std::string>& src)
+	{
+		this->_entries.reserve(src.size());
+		for (const auto& [key, value] : src)
+		{
+			this->_entries.push_back({
+				key,
+				value,
+				util::try_as<long long>(value),
+				util::try_as<unsigned long long>(value),
+				util::try_as<float>(value),
+				util::try_as<double>(value)
+			});
+		}
+	}
+
+	// Gets value by key and converts it to type T.
+	// See `Options::get`.
+	template <typename T>
+	inline T get(std::string_view key, T _default={}) const
+	{
+		auto entry = this->_find(key);
+		if (!entry)
+		{
+			return _default;
+		}
+
+		if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+		{
+			return _integer<T>(*entry).value_or(_default);
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return entry->float_value.value_or(_default);
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			return entry->double_value.value_or(_default);
+		}
+		else if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+		{
+			return util::try_as<T>(entry->value).value_or(_default);
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return entry->value;
+		}
+		else if constexpr (std::is_same_v<T, const char*>)
+		{
+			// Points to the snapshot, which must outlive the result.
+			return entry->value.c_str();
+		}
+		else
+		{
+			try
+			{
+				return util::as<T>((const char*)entry->value.c_str());
+			}
+			catch (const std::invalid_argument&)
+			{
+			}
+			catch (const std::range_error&)
+			{
+			}
+
+			return _default;
+		}
+	}
+
+	// Returns the value of `key` without copying it or `std::nullopt`
+	// if the key is not present.
+	[[nodiscard]]
+	inline std::optional<std::string_view> find(std::string_view key) const
+	{
+		auto entry = this->_find(key);
+		if (!entry)
+		{
+			return std::nullopt;
+		}
+
+		return entry->value;
+	}
+
+	[[nodiscard]]
+	inline bool contains(std::string_view key) const
+	{
+		return this->_find(key) != nullptr;
+	}
+
+	[[nodiscard]]
+	inline size_t size() const
+	{
+		return this->_entries.size();
+	}
+};
+
 // TODO: docs for 'Options'
 class Options final
 {
@@ -38,15 +203,26 @@ public:
 
 	// Gets value by key and converts it to type T.
 	// See util::as function in the 'utility.h' file for
-	// what types are supported.
+	// what types are supported. Numbers are parsed by
+	// util::try_as, so invalid values do not throw.
 	template <typename T>
 	inline T get(const std::string& key, T _default={}) const
 	{
-		if (this->contains(key))
+		auto it = this->_map.find(key);
+		if (it == this->_map.end())
+		{
+			return _default;
+		}
+
+		if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+		{
+			return util::try_as<T>(it->second).value_or(_default);
+		}
+		else
 		{
 			try
 			{
-				return util::as<T>((const char*)this->_map.at(key).c_str());
+				return util::as<T>((const char*)it->second.c_str());
 			}
 			catch (const std::invalid_argument&)
 			{
@@ -54,9 +230,9 @@ public:
 			catch (const std::range_error&)
 			{
 			}
-		}
 
-		return _default;
+			return _default;
+		}
 	}
 
 	inline void set(const std::string& key, const std::string& value)
@@ -69,6 +245,14 @@ public:
 	{
 		return this->_map.contains(key);
 	}
+
+	// Returns immutable snapshot of current options for fast reading.
+	// Later changes of options do not affect it.
+	[[nodiscard]]
+	inline FrozenOptions freeze() const
+	{
+		return FrozenOptions(this->_map);
+	}
 };
 
 __MAIN_NAMESPACE_END__
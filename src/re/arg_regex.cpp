@@ -13,12 +13,12 @@ ArgRegex& ArgRegex::operator= (const ArgRegex& other)
 {
 	if (this != &other)
 	{
-		this->_matches = other._matches;
 		this->_orig = other._orig;
-		this->_rgx = other._rgx;
+		this->_engine = other._engine;
 		this->_pattern_parts = other._pattern_parts;
 		this->_keys = other._keys;
 		this->_groups = other._groups;
+		this->_list_groups = other._list_groups;
 	}
 
 	return *this;
@@ -26,23 +26,20 @@ ArgRegex& ArgRegex::operator= (const ArgRegex& other)
 
 bool ArgRegex::search(const std::string& s)
 {
-	auto is_found = std::regex_search(s, this->_matches, this->_rgx);
+	auto match = this->find(s);
 	this->_groups.clear();
 	this->_list_groups.clear();
-	if (is_found)
+	for (size_t i = 1; i < match.size(); i++)
 	{
-		for (size_t i = 1; i < this->_matches.size(); i++)
+		if (match.matched(i))
 		{
-			if (this->_matches[i].matched)
-			{
-				auto str_match = this->_matches[i].str();
-				this->_groups[this->_keys[i - 1]] = str_match;
-				this->_list_groups.push_back(str_match);
-			}
+			auto str_match = std::string(match.group(i));
+			this->_groups[this->_keys[i - 1]] = str_match;
+			this->_list_groups.push_back(str_match);
 		}
 	}
 
-	return is_found;
+	return (bool)match;
 }
 
 std::string ArgRegex::arg(const std::string& key, const std::string& default_val) const
@@ -55,6 +52,19 @@ std::string ArgRegex::arg(const std::string& key, const std::string& default_val
 	return default_val;
 }
 
+std::string_view ArgRegex::arg(const Match& match, std::string_view key, std::string_view default_val) const
+{
+	for (size_t i = 0; i < this->_keys.size(); i++)
+	{
+		if (this->_keys[i] == key && match.matched(i + 1))
+		{
+			return match.group(i + 1);
+		}
+	}
+
+	return default_val;
+}
+
 std::string ArgRegex::_parse(const std::string& pattern)
 {
 	std::string new_pattern, part, arg_name;
@@ -6,7 +6,6 @@
 #pragma once
 
 // C++ libraries.
-#include <regex>
 #include <string>
 #include <vector>
 #include <map>
@@ -16,11 +15,17 @@
 
 // Base libraries.
 #include "../utility.h"
+#include "./cache.h"
+#include "./match.h"
 
 
 __RE_BEGIN__
 
 /** Regular expression with arguments.
+ *
+ * The compiled pattern is immutable and shared, see `compile`. Const
+ * methods can be called from many threads, `search` stores found
+ * arguments in the object and requires external synchronization.
  */
 class ArgRegex final
 {
@@ -30,15 +35,13 @@ private:
 		Str, CheckIfArg, ArgName, Regex
 	};
 
-	std::smatch _matches;
-
 	/** Original regular expression pattern.
 	 */
 	std::string _orig;
 
-	/** Regex instance without parameters.
+	/** Compiled regular expression without parameters.
 	 */
-	std::regex _rgx;
+	std::shared_ptr<const IEngine> _engine;
 
 	/** Vector of parsed parts between arguments.
 	 */
@@ -73,7 +76,7 @@ public:
 	 */
 	inline explicit ArgRegex(std::string pattern) : _orig(std::move(pattern))
 	{
-		this->_rgx = std::regex(this->_parse(this->_orig));
+		this->_engine = compile(this->_parse(this->_orig));
 	}
 
 	ArgRegex& operator= (const ArgRegex& other);
@@ -85,9 +88,42 @@ public:
 	[[nodiscard]]
 	inline bool match(const std::string& s) const
 	{
-		return std::regex_match(s, this->_rgx);
+		return this->_engine->match(s);
 	}
 
+	/** Searches for the first match without copying the string or
+	 * changing the object.
+	 *
+	 * \param s - string to search, must outlive the result
+	 * \return match where group `i + 1` is the value of argument `keys()[i]`
+	 */
+	[[nodiscard]]
+	inline Match find(std::string_view s) const
+	{
+		Match result;
+		result._search(*this->_engine, s, 0);
+		return result;
+	}
+
+	/** Same as above, but reuses the storage of `result`.
+	 *
+	 * \return `true` if the match is found, `false` otherwise
+	 */
+	inline bool find(std::string_view s, Match& result) const
+	{
+		return result._search(*this->_engine, s, 0);
+	}
+
+	/** Searches for argument by given key in the result of `find`.
+	 *
+	 * \param match - result of `find`
+	 * \param key - key to search for
+	 * \param default_val - value to return in case when key is not found
+	 * \return argument's value as a view into the searched string
+	 */
+	[[nodiscard]]
+	std::string_view arg(const Match& match, std::string_view key, std::string_view default_val="") const;
+
 	/** Clears the previous result and searches for substrings in given string.
 	 *
 	 * \return `true` if string matches the regular expression,
@@ -136,6 +172,14 @@ public:
 	[[nodiscard]]
 	std::string arg(const std::string& key, const std::string& default_val="") const;
 
+	/** Returns names of arguments in the same order as in the pattern.
+	 */
+	[[nodiscard]]
+	inline const std::vector<std::string>& keys() const
+	{
+		return this->_keys;
+	}
+
 	/** Returns parts without arguments.
 	 *
 	 * \return vector of regular expression parts.
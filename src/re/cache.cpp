@@ -0,0 +1,142 @@
+/**
+ * re/cache.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./cache.h"
+
+// C++ libraries.
+#include <cstdint>
+#include <future>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+
+__RE_BEGIN__
+
+using _CacheKey = std::tuple<std::string, std::regex_constants::syntax_option_type, Engine>;
+
+struct _CacheEntry
+{
+	std::shared_future<std::shared_ptr<const IEngine>> pattern;
+
+	// Position in `_Cache::order`.
+	std::list<_CacheKey>::iterator position;
+
+	// Distinguishes the entry from a later entry with the same key.
+	uint64_t id;
+};
+
+struct _Cache
+{
+	std::mutex mutex;
+	std::map<_CacheKey, _CacheEntry> patterns;
+
+	// Keys from the most to the least recently used.
+	std::list<_CacheKey> order;
+	size_t capacity = 1024;
+	uint64_t last_id = 0;
+
+	// Removes the least recently used patterns above `capacity`.
+	inline void shrink()
+	{
+		while (this->patterns.size() > this->capacity)
+		{
+			this->patterns.erase(this->order.back());
+			this->order.pop_back();
+		}
+	}
+};
+
+// Constructed on first use, so patterns can be compiled while
+// initializing global variables.
+static _Cache& _cache()
+{
+	static _Cache cache;
+	return cache;
+}
+
+std::shared_ptr<const IEngine> compile(
+	const std::string& expr, std::regex_constants::syntax_option_type type, Engine engine
+)
+{
+	auto& cache = _cache();
+	std::promise<std::shared_ptr<const IEngine>> promise;
+	std::shared_future<std::shared_ptr<const IEngine>> pattern;
+	auto key = _CacheKey(expr, type, engine);
+	uint64_t id = 0;
+	{
+		std::lock_guard<std::mutex> guard(cache.mutex);
+		if (cache.capacity == 0)
+		{
+			return make_engine(expr, type, engine);
+		}
+
+		auto it = cache.patterns.find(key);
+		if (it != cache.patterns.end())
+		{
+			cache.order.splice(cache.order.begin(), cache.order, it->second.position);
+			pattern = it->second.pattern;
+		}
+		else
+		{
+			pattern = promise.get_future().share();
+			id = ++cache.last_id;
+			cache.order.push_front(key);
+			cache.patterns.emplace(key, _CacheEntry{pattern, cache.order.begin(), id});
+			cache.shrink();
+		}
+	}
+
+	// The pattern is compiled outside the lock by the first caller, and
+	// only callers of the same pattern wait for it.
+	if (id)
+	{
+		try
+		{
+			promise.set_value(make_engine(expr, type, engine));
+		}
+		catch (...)
+		{
+			// Waiting callers get the same exception, and nothing is
+			// cached, so the next call compiles the pattern again.
+			promise.set_exception(std::current_exception());
+			std::lock_guard<std::mutex> guard(cache.mutex);
+			auto it = cache.patterns.find(key);
+			if (it != cache.patterns.end() && it->second.id == id)
+			{
+				cache.order.erase(it->second.position);
+				cache.patterns.erase(it);
+			}
+		}
+	}
+
+	return pattern.get();
+}
+
+void set_cache_capacity(size_t capacity)
+{
+	auto& cache = _cache();
+	std::lock_guard<std::mutex> guard(cache.mutex);
+	cache.capacity = capacity;
+	cache.shrink();
+}
+
+size_t cache_capacity()
+{
+	auto& cache = _cache();
+	std::lock_guard<std::mutex> guard(cache.mutex);
+	return cache.capacity;
+}
+
+size_t cache_size()
+{
+	auto& cache = _cache();
+	std::lock_guard<std::mutex> guard(cache.mutex);
+	return cache.patterns.size();
+}
+
+__RE_END__
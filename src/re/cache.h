@@ -0,0 +1,51 @@
+/**
+ * re/cache.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Process-wide cache of compiled regular expressions.
+ */
+
+#pragma once
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./engine.h"
+
+
+__RE_BEGIN__
+
+// Returns the compiled pattern shared by all callers. Each distinct
+// combination of arguments is compiled once and kept until it becomes
+// the least recently used one above `cache_capacity()`, so patterns
+// built at runtime, for example from user input, do not grow memory
+// without limit. Compiled patterns are immutable and can be used from
+// many threads.
+//
+// The first caller of a pattern compiles it without holding the cache
+// lock; concurrent callers of the same pattern wait for the result and
+// callers of other patterns are not blocked. Nothing is cached if
+// compilation throws.
+//
+// `expr`: regular expression pattern.
+// `type`: syntax options for regular expression.
+// `engine`: engine to compile the pattern with.
+extern std::shared_ptr<const IEngine> compile(
+	const std::string& expr,
+	std::regex_constants::syntax_option_type type=std::regex_constants::ECMAScript,
+	Engine engine=Engine::Auto
+);
+
+// Sets the maximum number of patterns in the cache, 1024 by default,
+// and evicts the least recently used ones above it. Zero disables
+// caching.
+extern void set_cache_capacity(size_t capacity);
+
+extern size_t cache_capacity();
+
+// Returns the number of patterns in the cache.
+extern size_t cache_size();
+
+__RE_END__
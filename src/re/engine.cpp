@@ -0,0 +1,70 @@
+/**
+ * re/engine.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./engine.h"
+
+// Base libraries.
+#include "../exceptions.h"
+#include "./nfa.h"
+
+
+__RE_BEGIN__
+
+bool StdEngine::search(std::string_view input, size_t start, std::vector<GroupOffsets>& groups) const
+{
+	auto flags = start > 0 ? std::regex_constants::match_prev_avail : std::regex_constants::match_default;
+	std::match_results<std::string_view::const_iterator> matches;
+	if (!std::regex_search(input.begin() + start, input.end(), matches, this->_regex, flags))
+	{
+		return false;
+	}
+
+	groups.resize(matches.size());
+	for (size_t i = 0; i < matches.size(); i++)
+	{
+		if (matches[i].matched)
+		{
+			groups[i] = {matches[i].first - input.begin(), matches[i].second - input.begin()};
+		}
+		else
+		{
+			groups[i] = {std::string::npos, std::string::npos};
+		}
+	}
+
+	return true;
+}
+
+bool StdEngine::match(std::string_view input) const
+{
+	return std::regex_match(input.begin(), input.end(), this->_regex);
+}
+
+std::shared_ptr<const IEngine> make_engine(
+	const std::string& expr, std::regex_constants::syntax_option_type type, Engine engine
+)
+{
+	// 'NfaEngine' implements default ECMAScript grammar only.
+	auto nfa_options = std::regex_constants::ECMAScript | std::regex_constants::optimize;
+	bool nfa_supported = (type & ~nfa_options) == std::regex_constants::syntax_option_type{};
+	if (engine != Engine::Std && nfa_supported)
+	{
+		auto nfa = NfaEngine::compile(expr);
+		if (nfa)
+		{
+			return nfa;
+		}
+	}
+
+	if (engine == Engine::Nfa)
+	{
+		throw ValueError("regular expression is not supported by NFA engine: " + expr, _ERROR_DETAILS_);
+	}
+
+	return std::make_shared<StdEngine>(expr, type);
+}
+
+__RE_END__
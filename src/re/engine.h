@@ -0,0 +1,99 @@
+/**
+ * re/engine.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Regular expression engines used by `Regex` and `IterRegex`.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <memory>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+
+__RE_BEGIN__
+
+// Available regular expression engines.
+enum class Engine
+{
+	// Linear-time engine if the pattern is supported by it, the
+	// standard library engine otherwise.
+	Auto,
+
+	// Linear-time engine, see `NfaEngine`.
+	Nfa,
+
+	// 'std::regex' engine.
+	Std
+};
+
+// Begin and end offsets of the group in the input string. Groups which
+// did not participate in the match have both offsets equal to `npos`.
+using GroupOffsets = std::pair<size_t, size_t>;
+
+// Compiled regular expression.
+class IEngine
+{
+public:
+	virtual ~IEngine() = default;
+
+	// Searches for the leftmost match in `input` starting at `start`.
+	// The part of the input before `start` is used for '^' and '\b'.
+	//
+	// `groups`: resized to `groups_count() + 1` and filled with offsets
+	// of the whole match and the groups.
+	//
+	// Returns `true` if the match is found, `false` otherwise.
+	virtual bool search(std::string_view input, size_t start, std::vector<GroupOffsets>& groups) const = 0;
+
+	// Checks if the whole `input` matches the regular expression.
+	[[nodiscard]]
+	virtual bool match(std::string_view input) const = 0;
+
+	// Returns the number of capturing groups.
+	[[nodiscard]]
+	virtual size_t groups_count() const = 0;
+};
+
+// Engine which delegates to 'std::regex'.
+class StdEngine final : public IEngine
+{
+private:
+	std::regex _regex;
+
+public:
+	inline explicit StdEngine(
+		const std::string& expr, std::regex_constants::syntax_option_type type=std::regex_constants::ECMAScript
+	) : _regex(expr, type)
+	{
+	}
+
+	bool search(std::string_view input, size_t start, std::vector<GroupOffsets>& groups) const override;
+
+	[[nodiscard]]
+	bool match(std::string_view input) const override;
+
+	[[nodiscard]]
+	inline size_t groups_count() const override
+	{
+		return this->_regex.mark_count();
+	}
+};
+
+// Compiles regular expression with the given engine.
+//
+// With `Engine::Nfa` throws `ValueError` if the pattern or syntax
+// options are not supported by `NfaEngine`.
+extern std::shared_ptr<const IEngine> make_engine(
+	const std::string& expr, std::regex_constants::syntax_option_type type, Engine engine
+);
+
+__RE_END__
@@ -17,12 +17,16 @@ IterRegex& IterRegex::operator= (const IterRegex& other)
 	if (this != &other)
 	{
 		this->_start = other._start;
-		this->_end = other._end;
 		this->_is_initialized = other._is_initialized;
+		this->_owns_input = other._owns_input;
 		this->_to_search = other._to_search;
-		this->_expr = other._expr;
+		this->_engine = other._engine;
 		this->_raw_expr = other._raw_expr;
-		this->_groups = other._groups;
+		this->_match = other._match;
+		if (this->_owns_input)
+		{
+			this->_match._input = this->_to_search;
+		}
 	}
 
 	return *this;
@@ -31,8 +35,20 @@ IterRegex& IterRegex::operator= (const IterRegex& other)
 void IterRegex::setup(std::string s)
 {
 	this->_to_search = std::move(s);
-	this->_start = this->_to_search.cbegin();
-	this->_end = this->_to_search.cend();
+	this->_owns_input = true;
+	this->_match = Match();
+	this->_match._input = this->_to_search;
+	this->_start = 0;
+	this->_is_initialized = true;
+}
+
+void IterRegex::setup_view(std::string_view s)
+{
+	this->_to_search.clear();
+	this->_owns_input = false;
+	this->_match = Match();
+	this->_match._input = s;
+	this->_start = 0;
 	this->_is_initialized = true;
 }
 
@@ -45,31 +61,41 @@ bool IterRegex::search_next()
 		);
 	}
 
-	this->_groups.clear();
-	std::smatch matches;
-	bool is_found = false;
-	if (std::regex_search(this->_start, this->_end, matches, this->_expr))
+	if (!this->_match._search(*this->_engine, this->_match._input, this->_start))
 	{
-		for (const auto & match : matches)
+		// Keep the iteration finished.
+		this->_start = std::string::npos;
+		return false;
+	}
+
+	// Step over an empty match to avoid matching it again.
+	auto [begin, end] = this->_match._offsets[0];
+	this->_start = end + (begin == end);
+	return true;
+}
+
+std::vector<std::string> IterRegex::groups() const
+{
+	std::vector<std::string> result;
+	for (size_t i = 0; i < this->_match.size(); i++)
+	{
+		if (this->_match.matched(i))
 		{
-			if (match.matched)
-			{
-				this->_groups.push_back(match.str());
-			}
+			result.emplace_back(this->_match.group(i));
 		}
-
-		this->_start = matches.suffix().first;
-		is_found = true;
 	}
 
-	return is_found;
+	return result;
 }
 
 std::string IterRegex::group(size_t pos) const
 {
-	if (pos >= 0 && pos < this->_groups.size())
+	for (size_t i = 0; i < this->_match.size(); i++)
 	{
-		return this->_groups[pos];
+		if (this->_match.matched(i) && pos-- == 0)
+		{
+			return std::string(this->_match.group(i));
+		}
 	}
 
 	return "";
@@ -14,19 +14,26 @@
 // Module definitions.
 #include "./_def_.h"
 
+// Base libraries.
+#include "./cache.h"
+#include "./match.h"
+
 
 __RE_BEGIN__
 
 class IterRegex final
 {
 private:
-	std::string::const_iterator _start;
-	std::string::const_iterator _end;
+	size_t _start = 0;
 	bool _is_initialized;
+
+	// Set if the searched string is stored in `_to_search`, otherwise
+	// the current match refers to the caller's buffer.
+	bool _owns_input = false;
 	std::string _to_search;
-	std::regex _expr;
+	std::shared_ptr<const IEngine> _engine;
 	std::string _raw_expr;
-	std::vector<std::string> _groups;
+	Match _match;
 
 public:
 
@@ -38,9 +45,10 @@ public:
 	// Constructs regular expression from string.
 	//
 	// `expr`: regular expression pattern.
-	inline explicit IterRegex(const std::string& expr) : _raw_expr(expr), _is_initialized(false)
+	// `engine`: engine to compile the pattern with.
+	inline explicit IterRegex(const std::string& expr, Engine engine=Engine::Auto) :
+		IterRegex(expr, std::regex_constants::ECMAScript, engine)
 	{
-		this->_expr = std::regex(expr);
 	}
 
 	// Constructs regular expression from string with
@@ -48,10 +56,18 @@ public:
 	//
 	// `expr`: regular expression pattern.
 	// `sot`: syntax options for regular expression.
-	inline explicit IterRegex(const std::string& expr, std::regex_constants::syntax_option_type type) :
-		_raw_expr(expr), _is_initialized(false)
+	// `engine`: engine to compile the pattern with.
+	inline explicit IterRegex(
+		const std::string& expr, std::regex_constants::syntax_option_type type, Engine engine=Engine::Auto
+	) : _is_initialized(false), _raw_expr(expr)
+	{
+		this->_engine = compile(expr, type, engine);
+	}
+
+	// Copy constructor.
+	inline IterRegex(const IterRegex& other) : _is_initialized(false)
 	{
-		this->_expr = std::regex(expr, type);
+		*this = other;
 	}
 
 	// Copy assignment operator.
@@ -62,6 +78,11 @@ public:
 	// `s`: string to search.
 	void setup(std::string s);
 
+	// Setups given string without copying it.
+	//
+	// `s`: string to search, must outlive the iteration.
+	void setup_view(std::string_view s);
+
 	// Searches for substrings in current iteration and
 	// builds groups.
 	//
@@ -69,13 +90,28 @@ public:
 	// `false` otherwise.
 	bool search_next();
 
-	// Returns groups found during current iteration step.
+	// Returns the match found during current iteration step. Groups
+	// refer to the searched string.
 	[[nodiscard]]
-	inline std::vector<std::string> groups() const
+	inline const Match& match() const
 	{
-		return this->_groups;
+		return this->_match;
 	}
 
+	// Returns a range over all non-overlapping matches in `s`. Does
+	// not change the state of the iteration.
+	//
+	// `s`: string to search, must outlive the range.
+	[[nodiscard]]
+	inline MatchRange find_all(std::string_view s) const
+	{
+		return {this->_engine, s};
+	}
+
+	// Returns groups found during current iteration step.
+	[[nodiscard]]
+	std::vector<std::string> groups() const;
+
 	// Returns group by given position.
 	//
 	// If group is not found returns empty string.
@@ -0,0 +1,48 @@
+/**
+ * re/match.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./match.h"
+
+
+__RE_BEGIN__
+
+bool Match::_search(const IEngine& engine, std::string_view input, size_t start)
+{
+	this->_input = input;
+	if (start > input.size() || !engine.search(input, start, this->_offsets))
+	{
+		this->_offsets.clear();
+		return false;
+	}
+
+	return true;
+}
+
+MatchIterator::MatchIterator(const IEngine* engine, std::string_view input) : _engine(engine), _next(0)
+{
+	this->_match._input = input;
+	this->_advance();
+}
+
+void MatchIterator::_advance()
+{
+	if (this->_next == std::string::npos)
+	{
+		return;
+	}
+
+	if (!this->_match._search(*this->_engine, this->_match._input, this->_next))
+	{
+		this->_next = std::string::npos;
+		return;
+	}
+
+	// Step over an empty match to avoid matching it again.
+	auto [begin, end] = this->_match._offsets[0];
+	this->_next = end + (begin == end);
+}
+
+__RE_END__
@@ -0,0 +1,197 @@
+/**
+ * re/match.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Match results which refer to the searched string without copying it.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./engine.h"
+
+
+__RE_BEGIN__
+
+// Result of a single search. Groups are stored as offsets into the
+// searched string, so the string must outlive the match object.
+class Match final
+{
+private:
+	std::string_view _input;
+	std::vector<GroupOffsets> _offsets;
+
+	friend class ArgRegex;
+	friend class IterRegex;
+	friend class MatchIterator;
+	friend class Regex;
+
+	// Searches with `engine` in `input` starting at `start`, reusing
+	// the storage of offsets. Clears the match if nothing is found.
+	bool _search(const IEngine& engine, std::string_view input, size_t start);
+
+public:
+	inline Match() = default;
+
+	// Returns `true` if the search succeeded.
+	inline explicit operator bool() const
+	{
+		return !this->_offsets.empty();
+	}
+
+	// Returns the number of groups including the whole match which is
+	// group 0, or 0 if nothing is matched.
+	[[nodiscard]]
+	inline size_t size() const
+	{
+		return this->_offsets.size();
+	}
+
+	// Checks if the group at `pos` participated in the match.
+	[[nodiscard]]
+	inline bool matched(size_t pos) const
+	{
+		return pos < this->_offsets.size() && this->_offsets[pos].first != std::string::npos;
+	}
+
+	// Returns the group at `pos` as a view into the searched string.
+	//
+	// Returns empty view if the group did not participate in the match.
+	[[nodiscard]]
+	inline std::string_view group(size_t pos=0) const
+	{
+		if (!this->matched(pos))
+		{
+			return {};
+		}
+
+		const auto& [begin, end] = this->_offsets[pos];
+		return this->_input.substr(begin, end - begin);
+	}
+
+	// Returns the offset of the group's beginning in the searched
+	// string, or `npos` if the group did not participate in the match.
+	[[nodiscard]]
+	inline size_t start(size_t pos=0) const
+	{
+		return this->matched(pos) ? this->_offsets[pos].first : std::string::npos;
+	}
+
+	// Returns the offset past the group's end in the searched string,
+	// or `npos` if the group did not participate in the match.
+	[[nodiscard]]
+	inline size_t end(size_t pos=0) const
+	{
+		return this->matched(pos) ? this->_offsets[pos].second : std::string::npos;
+	}
+
+	// Returns the searched string.
+	[[nodiscard]]
+	inline std::string_view input() const
+	{
+		return this->_input;
+	}
+};
+
+// Iterates over non-overlapping matches from left to right. The same
+// `Match` object is reused for every step, so the storage of offsets
+// is allocated once; the engine may still allocate for each search.
+class MatchIterator final
+{
+private:
+	const IEngine* _engine = nullptr;
+	Match _match;
+
+	// Offset where the next search begins, `npos` for the end iterator.
+	size_t _next = std::string::npos;
+
+	void _advance();
+
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = Match;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const Match*;
+	using reference = const Match&;
+
+	// Constructs the end iterator.
+	inline MatchIterator() = default;
+
+	// Constructs iterator which points to the first match in `input`.
+	MatchIterator(const IEngine* engine, std::string_view input);
+
+	inline reference operator* () const
+	{
+		return this->_match;
+	}
+
+	inline pointer operator-> () const
+	{
+		return &this->_match;
+	}
+
+	inline MatchIterator& operator++ ()
+	{
+		this->_advance();
+		return *this;
+	}
+
+	// End iterators are equal, other iterators are equal if they
+	// search the same string with the same engine at the same offset.
+	inline bool operator== (const MatchIterator& other) const
+	{
+		if (this->_next != other._next)
+		{
+			return false;
+		}
+
+		return this->_next == std::string::npos || (
+			this->_engine == other._engine &&
+			this->_match._input.data() == other._match._input.data() &&
+			this->_match._input.size() == other._match._input.size()
+		);
+	}
+
+	inline bool operator!= (const MatchIterator& other) const
+	{
+		return !(*this == other);
+	}
+};
+
+// Range of all matches in a string, see `Regex::find_all`.
+class MatchRange final
+{
+private:
+	std::shared_ptr<const IEngine> _engine;
+	std::string_view _input;
+
+public:
+	inline MatchRange(std::shared_ptr<const IEngine> engine, std::string_view input) :
+		_engine(std::move(engine)), _input(input)
+	{
+	}
+
+	[[nodiscard]]
+	inline MatchIterator begin() const
+	{
+		return MatchIterator(this->_engine.get(), this->_input);
+	}
+
+	[[nodiscard]]
+	inline MatchIterator end() const
+	{
+		return {};
+	}
+};
+
+__RE_END__
@@ -0,0 +1,1001 @@
+/**
+ * re/nfa.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./nfa.h"
+
+
+__RE_BEGIN__
+
+// The maximum number of instructions in compiled program. Larger
+// patterns, usually produced by counted repetitions, are left to
+// 'std::regex'.
+inline constexpr const size_t NFA_MAX_PROGRAM_SIZE = 10000;
+
+static inline void _add(NfaEngine::ByteSet& set, uint8_t c)
+{
+	set[c >> 6] |= (uint64_t)1 << (c & 63);
+}
+
+static inline bool _contains(const NfaEngine::ByteSet& set, uint8_t c)
+{
+	return (set[c >> 6] >> (c & 63)) & 1;
+}
+
+static inline void _add_range(NfaEngine::ByteSet& set, uint8_t lo, uint8_t hi)
+{
+	for (int c = lo; c <= hi; c++)
+	{
+		_add(set, (uint8_t)c);
+	}
+}
+
+static inline void _invert(NfaEngine::ByteSet& set)
+{
+	for (auto& word : set)
+	{
+		word = ~word;
+	}
+}
+
+static inline bool _is_word(uint8_t c)
+{
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static inline bool _is_hex(char c)
+{
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+static inline uint8_t _unhex(char c)
+{
+	if (c >= '0' && c <= '9')
+	{
+		return c - '0';
+	}
+
+	return (c | 0x20) - 'a' + 10;
+}
+
+// Thrown by parser if the pattern is not supported.
+struct _Unsupported
+{
+};
+
+struct _Node
+{
+	enum class Type
+	{
+		Empty, Byte, Class, Any, Concat, Alternate, Repeat, Group, Bol, Eol, WordBoundary, NotWordBoundary
+	};
+
+	Type type = Type::Empty;
+	uint8_t byte = 0;
+	size_t cls = 0;
+
+	// Index of capturing group, zero for non-capturing one.
+	size_t group = 0;
+	size_t min = 0;
+
+	// Negative value means no upper bound.
+	long max = 0;
+	bool greedy = true;
+	std::vector<std::unique_ptr<_Node>> children;
+
+	inline explicit _Node(Type type) : type(type)
+	{
+	}
+};
+
+class _Parser
+{
+private:
+	std::string_view _s;
+	size_t _pos = 0;
+	std::vector<NfaEngine::ByteSet>& _classes;
+
+	[[nodiscard]]
+	inline bool _eof() const
+	{
+		return this->_pos >= this->_s.size();
+	}
+
+	[[nodiscard]]
+	inline char _peek() const
+	{
+		return this->_s[this->_pos];
+	}
+
+	inline std::unique_ptr<_Node> _class_node(const NfaEngine::ByteSet& set)
+	{
+		auto node = std::make_unique<_Node>(_Node::Type::Class);
+		node->cls = this->_classes.size();
+		this->_classes.push_back(set);
+		return node;
+	}
+
+	// Adds set of '\d', '\w', '\s' and their negations to `set`.
+	//
+	// Returns `false` if `c` is not a class escape.
+	static bool _class_escape(char c, NfaEngine::ByteSet& set)
+	{
+		NfaEngine::ByteSet escaped{};
+		switch (c | 0x20)
+		{
+			case 'd':
+				_add_range(escaped, '0', '9');
+				break;
+			case 'w':
+				for (int i = 0; i < 256; i++)
+				{
+					if (_is_word((uint8_t)i))
+					{
+						_add(escaped, (uint8_t)i);
+					}
+				}
+				break;
+			case 's':
+				for (auto space : {' ', '\t', '\n', '\v', '\f', '\r'})
+				{
+					_add(escaped, (uint8_t)space);
+				}
+				break;
+			default:
+				return false;
+		}
+
+		if (c >= 'A' && c <= 'Z')
+		{
+			_invert(escaped);
+		}
+
+		for (size_t i = 0; i < set.size(); i++)
+		{
+			set[i] |= escaped[i];
+		}
+
+		return true;
+	}
+
+	// Parses escape sequence of a single byte, the backslash is
+	// already consumed.
+	uint8_t _byte_escape(bool in_class)
+	{
+		if (this->_eof())
+		{
+			throw _Unsupported();
+		}
+
+		auto c = this->_s[this->_pos++];
+		switch (c)
+		{
+			case 'n':
+				return '\n';
+			case 'r':
+				return '\r';
+			case 't':
+				return '\t';
+			case 'v':
+				return '\v';
+			case 'f':
+				return '\f';
+			case 'b':
+				if (in_class)
+				{
+					return '\b';
+				}
+
+				throw _Unsupported();
+			case '0':
+				if (!this->_eof() && this->_peek() >= '0' && this->_peek() <= '9')
+				{
+					throw _Unsupported();
+				}
+
+				return '\0';
+			case 'x':
+				if (this->_pos + 2 > this->_s.size() || !_is_hex(this->_s[this->_pos]) || !_is_hex(this->_s[this->_pos + 1]))
+				{
+					throw _Unsupported();
+				}
+
+				this->_pos += 2;
+				return (uint8_t)(_unhex(this->_s[this->_pos - 2]) << 4 | _unhex(this->_s[this->_pos - 1]));
+			default:
+				// Back references and other letter escapes are not supported.
+				if (_is_word((uint8_t)c))
+				{
+					throw _Unsupported();
+				}
+
+				return (uint8_t)c;
+		}
+	}
+
+	std::unique_ptr<_Node> _parse_class()
+	{
+		NfaEngine::ByteSet set{};
+		bool negate = false;
+		if (!this->_eof() && this->_peek() == '^')
+		{
+			negate = true;
+			this->_pos++;
+		}
+
+		while (true)
+		{
+			if (this->_eof())
+			{
+				throw _Unsupported();
+			}
+
+			auto c = this->_s[this->_pos++];
+			if (c == ']')
+			{
+				break;
+			}
+
+			uint8_t lo;
+			if (c == '\\')
+			{
+				if (!this->_eof() && _class_escape(this->_peek(), set))
+				{
+					this->_pos++;
+					continue;
+				}
+
+				lo = this->_byte_escape(true);
+			}
+			else
+			{
+				lo = (uint8_t)c;
+			}
+
+			if (this->_pos + 1 < this->_s.size() && this->_peek() == '-' && this->_s[this->_pos + 1] != ']')
+			{
+				this->_pos++;
+				auto hi_char = this->_s[this->_pos++];
+				uint8_t hi;
+				if (hi_char == '\\')
+				{
+					if (!this->_eof() && _class_escape(this->_peek(), set))
+					{
+						throw _Unsupported();
+					}
+
+					hi = this->_byte_escape(true);
+				}
+				else
+				{
+					hi = (uint8_t)hi_char;
+				}
+
+				if (hi < lo)
+				{
+					throw _Unsupported();
+				}
+
+				_add_range(set, lo, hi);
+			}
+			else
+			{
+				_add(set, lo);
+			}
+		}
+
+		if (negate)
+		{
+			_invert(set);
+		}
+
+		return this->_class_node(set);
+	}
+
+	std::unique_ptr<_Node> _parse_atom()
+	{
+		auto c = this->_s[this->_pos++];
+		switch (c)
+		{
+			case '(':
+			{
+				auto node = std::make_unique<_Node>(_Node::Type::Group);
+				if (!this->_eof() && this->_peek() == '?')
+				{
+					if (this->_pos + 1 >= this->_s.size() || this->_s[this->_pos + 1] != ':')
+					{
+						throw _Unsupported();
+					}
+
+					this->_pos += 2;
+				}
+				else
+				{
+					node->group = ++this->groups_count;
+				}
+
+				node->children.push_back(this->parse_alternate());
+				if (this->_eof() || this->_peek() != ')')
+				{
+					throw _Unsupported();
+				}
+
+				this->_pos++;
+				return node;
+			}
+			case '[':
+				return this->_parse_class();
+			case '.':
+				return std::make_unique<_Node>(_Node::Type::Any);
+			case '^':
+				return std::make_unique<_Node>(_Node::Type::Bol);
+			case '$':
+				return std::make_unique<_Node>(_Node::Type::Eol);
+			case '\\':
+			{
+				if (this->_eof())
+				{
+					throw _Unsupported();
+				}
+
+				auto e = this->_peek();
+				if (e == 'b' || e == 'B')
+				{
+					this->_pos++;
+					return std::make_unique<_Node>(
+						e == 'b' ? _Node::Type::WordBoundary : _Node::Type::NotWordBoundary
+					);
+				}
+
+				NfaEngine::ByteSet set{};
+				if (_class_escape(e, set))
+				{
+					this->_pos++;
+					return this->_class_node(set);
+				}
+
+				auto node = std::make_unique<_Node>(_Node::Type::Byte);
+				node->byte = this->_byte_escape(false);
+				return node;
+			}
+			case ')':
+			case '*':
+			case '+':
+			case '?':
+			case '{':
+				throw _Unsupported();
+			default:
+			{
+				auto node = std::make_unique<_Node>(_Node::Type::Byte);
+				node->byte = (uint8_t)c;
+				return node;
+			}
+		}
+	}
+
+	// Parses a number for '{n,m}' quantifier.
+	long _parse_number()
+	{
+		long result = 0;
+		auto begin = this->_pos;
+		while (!this->_eof() && this->_peek() >= '0' && this->_peek() <= '9')
+		{
+			result = result * 10 + (this->_s[this->_pos++] - '0');
+			if (result > (long)NFA_MAX_PROGRAM_SIZE)
+			{
+				throw _Unsupported();
+			}
+		}
+
+		if (begin == this->_pos)
+		{
+			throw _Unsupported();
+		}
+
+		return result;
+	}
+
+	std::unique_ptr<_Node> _parse_repeat()
+	{
+		auto atom = this->_parse_atom();
+		while (!this->_eof())
+		{
+			auto c = this->_peek();
+			long min, max;
+			if (c == '*')
+			{
+				min = 0, max = -1;
+			}
+			else if (c == '+')
+			{
+				min = 1, max = -1;
+			}
+			else if (c == '?')
+			{
+				min = 0, max = 1;
+			}
+			else if (c == '{')
+			{
+				this->_pos++;
+				min = max = this->_parse_number();
+				if (!this->_eof() && this->_peek() == ',')
+				{
+					this->_pos++;
+					max = !this->_eof() && this->_peek() == '}' ? -1 : this->_parse_number();
+				}
+
+				if (this->_eof() || this->_peek() != '}' || (max >= 0 && max < min))
+				{
+					throw _Unsupported();
+				}
+			}
+			else
+			{
+				break;
+			}
+
+			this->_pos++;
+			switch (atom->type)
+			{
+				case _Node::Type::Bol:
+				case _Node::Type::Eol:
+				case _Node::Type::WordBoundary:
+				case _Node::Type::NotWordBoundary:
+				case _Node::Type::Repeat:
+					throw _Unsupported();
+				default:
+					break;
+			}
+
+			auto node = std::make_unique<_Node>(_Node::Type::Repeat);
+			node->min = (size_t)min;
+			node->max = max;
+			if (!this->_eof() && this->_peek() == '?')
+			{
+				node->greedy = false;
+				this->_pos++;
+			}
+
+			node->children.push_back(std::move(atom));
+			atom = std::move(node);
+		}
+
+		return atom;
+	}
+
+public:
+	size_t groups_count = 0;
+
+	inline _Parser(std::string_view s, std::vector<NfaEngine::ByteSet>& classes) : _s(s), _classes(classes)
+	{
+	}
+
+	std::unique_ptr<_Node> parse_alternate()
+	{
+		auto node = std::make_unique<_Node>(_Node::Type::Alternate);
+		while (true)
+		{
+			auto concat = std::make_unique<_Node>(_Node::Type::Concat);
+			while (!this->_eof() && this->_peek() != '|' && this->_peek() != ')')
+			{
+				concat->children.push_back(this->_parse_repeat());
+			}
+
+			node->children.push_back(std::move(concat));
+			if (this->_eof() || this->_peek() != '|')
+			{
+				break;
+			}
+
+			this->_pos++;
+		}
+
+		if (node->children.size() == 1)
+		{
+			return std::move(node->children[0]);
+		}
+
+		return node;
+	}
+
+	[[nodiscard]]
+	inline bool finished() const
+	{
+		return this->_eof();
+	}
+};
+
+class _Emitter
+{
+private:
+	std::vector<NfaEngine::Inst>& _program;
+
+	inline size_t _push(NfaEngine::Op op, uint32_t x=0, uint32_t y=0, uint8_t byte=0)
+	{
+		if (this->_program.size() >= NFA_MAX_PROGRAM_SIZE)
+		{
+			throw _Unsupported();
+		}
+
+		this->_program.push_back({op, byte, x, y});
+		return this->_program.size() - 1;
+	}
+
+	[[nodiscard]]
+	inline uint32_t _pc() const
+	{
+		return (uint32_t)this->_program.size();
+	}
+
+public:
+	inline explicit _Emitter(std::vector<NfaEngine::Inst>& program) : _program(program)
+	{
+	}
+
+	void emit(const _Node& node)
+	{
+		using Op = NfaEngine::Op;
+		switch (node.type)
+		{
+			case _Node::Type::Empty:
+				break;
+			case _Node::Type::Byte:
+				this->_push(Op::Byte, 0, 0, node.byte);
+				break;
+			case _Node::Type::Class:
+				this->_push(Op::Class, (uint32_t)node.cls);
+				break;
+			case _Node::Type::Any:
+				this->_push(Op::Any);
+				break;
+			case _Node::Type::Bol:
+				this->_push(Op::Bol);
+				break;
+			case _Node::Type::Eol:
+				this->_push(Op::Eol);
+				break;
+			case _Node::Type::WordBoundary:
+				this->_push(Op::WordBoundary);
+				break;
+			case _Node::Type::NotWordBoundary:
+				this->_push(Op::NotWordBoundary);
+				break;
+			case _Node::Type::Concat:
+				for (const auto& child : node.children)
+				{
+					this->emit(*child);
+				}
+				break;
+			case _Node::Type::Group:
+				if (node.group)
+				{
+					this->_push(Op::Save, (uint32_t)(node.group * 2));
+				}
+
+				this->emit(*node.children[0]);
+				if (node.group)
+				{
+					this->_push(Op::Save, (uint32_t)(node.group * 2 + 1));
+				}
+				break;
+			case _Node::Type::Alternate:
+			{
+				std::vector<size_t> jumps;
+				for (size_t i = 0; i < node.children.size(); i++)
+				{
+					if (i + 1 == node.children.size())
+					{
+						this->emit(*node.children[i]);
+						break;
+					}
+
+					auto split = this->_push(Op::Split, this->_pc() + 1);
+					this->emit(*node.children[i]);
+					jumps.push_back(this->_push(Op::Jmp));
+					this->_program[split].y = this->_pc();
+				}
+
+				for (auto jump : jumps)
+				{
+					this->_program[jump].x = this->_pc();
+				}
+				break;
+			}
+			case _Node::Type::Repeat:
+			{
+				const auto& child = *node.children[0];
+				for (size_t i = 0; i < node.min; i++)
+				{
+					this->emit(child);
+				}
+
+				if (node.max < 0)
+				{
+					auto loop = this->_push(Op::Split);
+					this->emit(child);
+					this->_push(Op::Jmp, (uint32_t)loop);
+					this->_set_split(loop, (uint32_t)loop + 1, this->_pc(), node.greedy);
+				}
+				else
+				{
+					// Nested optional copies: 'x{0,2}' is '(x(x)?)?'.
+					std::vector<size_t> splits;
+					for (long i = (long)node.min; i < node.max; i++)
+					{
+						splits.push_back(this->_push(Op::Split));
+						this->emit(child);
+					}
+
+					for (auto split : splits)
+					{
+						this->_set_split(split, (uint32_t)split + 1, this->_pc(), node.greedy);
+					}
+				}
+				break;
+			}
+		}
+	}
+
+	inline void _set_split(size_t pc, uint32_t body, uint32_t exit, bool greedy)
+	{
+		this->_program[pc].x = greedy ? body : exit;
+		this->_program[pc].y = greedy ? exit : body;
+	}
+
+	inline void push_save(uint32_t slot)
+	{
+		this->_push(NfaEngine::Op::Save, slot);
+	}
+
+	inline void push_match()
+	{
+		this->_push(NfaEngine::Op::Match);
+	}
+};
+
+std::unique_ptr<NfaEngine> NfaEngine::compile(const std::string& expr)
+{
+	std::unique_ptr<NfaEngine> engine(new NfaEngine());
+	try
+	{
+		_Parser parser(expr, engine->_classes);
+		auto root = parser.parse_alternate();
+		if (!parser.finished())
+		{
+			return nullptr;
+		}
+
+		engine->_groups_count = parser.groups_count;
+		_Emitter emitter(engine->_program);
+		emitter.push_save(0);
+		emitter.emit(*root);
+		emitter.push_save(1);
+		emitter.push_match();
+	}
+	catch (const _Unsupported&)
+	{
+		return nullptr;
+	}
+
+	engine->_compute_first_bytes();
+	return engine;
+}
+
+void NfaEngine::_compute_first_bytes()
+{
+	std::vector<bool> visited(this->_program.size());
+	std::vector<uint32_t> stack{0};
+	ByteSet first{};
+	while (!stack.empty())
+	{
+		auto pc = stack.back();
+		stack.pop_back();
+		if (visited[pc])
+		{
+			continue;
+		}
+
+		visited[pc] = true;
+		const auto& inst = this->_program[pc];
+		switch (inst.op)
+		{
+			case Op::Byte:
+				_add(first, inst.byte);
+				break;
+			case Op::Class:
+				for (size_t i = 0; i < first.size(); i++)
+				{
+					first[i] |= this->_classes[inst.x][i];
+				}
+				break;
+			case Op::Any:
+				// Any byte except line terminators.
+				_add_range(first, 0, 255);
+				first['\n' >> 6] &= ~((uint64_t)1 << ('\n' & 63));
+				first['\r' >> 6] &= ~((uint64_t)1 << ('\r' & 63));
+				break;
+			case Op::Split:
+				stack.push_back(inst.y);
+				stack.push_back(inst.x);
+				break;
+			case Op::Jmp:
+				stack.push_back(inst.x);
+				break;
+			case Op::Save:
+				stack.push_back(pc + 1);
+				break;
+			default:
+				// Assertions and empty matches.
+				return;
+		}
+	}
+
+	this->_first_bytes = first;
+	this->_use_first_bytes = true;
+}
+
+// Sparse set of threads with capture slots for each thread. Only the
+// first `size` entries of `dense` are valid, so the set is cleared
+// without touching the memory.
+struct _Threads
+{
+	std::vector<uint32_t> sparse;
+	std::vector<uint32_t> dense;
+	std::vector<size_t> caps;
+	size_t size = 0;
+	size_t caps_count = 0;
+
+	// Clears the set and grows the storage if it is too small for
+	// the program. The storage is never shrunk.
+	inline void reset(size_t program_size, size_t caps_count)
+	{
+		if (this->sparse.size() < program_size)
+		{
+			this->sparse.resize(program_size);
+			this->dense.resize(program_size);
+		}
+
+		if (this->caps.size() < program_size * caps_count)
+		{
+			this->caps.resize(program_size * caps_count);
+		}
+
+		this->size = 0;
+		this->caps_count = caps_count;
+	}
+
+	[[nodiscard]]
+	inline bool contains(uint32_t pc) const
+	{
+		auto i = this->sparse[pc];
+		return i < this->size && this->dense[i] == pc;
+	}
+
+	inline size_t insert(uint32_t pc)
+	{
+		this->sparse[pc] = (uint32_t)this->size;
+		this->dense[this->size] = pc;
+		return this->size++;
+	}
+
+	inline size_t* caps_of(size_t i)
+	{
+		return this->caps.data() + i * this->caps_count;
+	}
+};
+
+// Frame of 'add_thread' stack: either instruction to follow or capture
+// slot to restore.
+struct _Frame
+{
+	uint32_t pc;
+	uint32_t slot;
+	size_t value;
+	bool restore;
+};
+
+// Memory used by a single run of the program.
+struct _Scratch
+{
+	_Threads current;
+	_Threads next;
+	std::vector<size_t> work;
+	std::vector<size_t> matched_caps;
+	std::vector<_Frame> stack;
+};
+
+// Returns the scratch of the calling thread prepared for the program.
+// Runs do not nest, so one scratch per thread is shared by all engines
+// and the memory is allocated only when a larger program is run.
+static _Scratch& _scratch(size_t program_size, size_t caps_count)
+{
+	thread_local _Scratch scratch;
+	scratch.current.reset(program_size, caps_count);
+	scratch.next.reset(program_size, caps_count);
+	scratch.work.resize(caps_count);
+	scratch.matched_caps.clear();
+	scratch.stack.clear();
+	return scratch;
+}
+
+static inline bool _is_word_boundary(std::string_view input, size_t pos)
+{
+	bool before = pos > 0 && _is_word((uint8_t)input[pos - 1]);
+	bool after = pos < input.size() && _is_word((uint8_t)input[pos]);
+	return before != after;
+}
+
+// Follows empty transitions from `pc0` at position `pos` and adds
+// reached threads to `list`.
+static void _add_thread(
+	const std::vector<NfaEngine::Inst>& program, _Threads& list, uint32_t pc0,
+	std::string_view input, size_t pos, size_t* caps, std::vector<_Frame>& stack
+)
+{
+	using Op = NfaEngine::Op;
+	stack.push_back({pc0, 0, 0, false});
+	while (!stack.empty())
+	{
+		auto frame = stack.back();
+		stack.pop_back();
+		if (frame.restore)
+		{
+			caps[frame.slot] = frame.value;
+			continue;
+		}
+
+		auto pc = frame.pc;
+		if (list.contains(pc))
+		{
+			continue;
+		}
+
+		auto i = list.insert(pc);
+		const auto& inst = program[pc];
+		switch (inst.op)
+		{
+			case Op::Jmp:
+				stack.push_back({inst.x, 0, 0, false});
+				break;
+			case Op::Split:
+				stack.push_back({inst.y, 0, 0, false});
+				stack.push_back({inst.x, 0, 0, false});
+				break;
+			case Op::Save:
+				stack.push_back({0, inst.x, caps[inst.x], true});
+				caps[inst.x] = pos;
+				stack.push_back({pc + 1, 0, 0, false});
+				break;
+			case Op::Bol:
+				if (pos == 0)
+				{
+					stack.push_back({pc + 1, 0, 0, false});
+				}
+				break;
+			case Op::Eol:
+				if (pos == input.size())
+				{
+					stack.push_back({pc + 1, 0, 0, false});
+				}
+				break;
+			case Op::WordBoundary:
+			case Op::NotWordBoundary:
+				if (_is_word_boundary(input, pos) == (inst.op == Op::WordBoundary))
+				{
+					stack.push_back({pc + 1, 0, 0, false});
+				}
+				break;
+			default:
+				std::copy(caps, caps + list.caps_count, list.caps_of(i));
+				break;
+		}
+	}
+}
+
+bool NfaEngine::_run(std::string_view input, size_t start, bool full, std::vector<GroupOffsets>* groups) const
+{
+	auto caps_count = (this->_groups_count + 1) * 2;
+	auto size = input.size();
+	auto& scratch = _scratch(this->_program.size(), caps_count);
+	auto& current = scratch.current;
+	auto& next = scratch.next;
+	auto& work = scratch.work;
+	auto& matched_caps = scratch.matched_caps;
+	auto& stack = scratch.stack;
+	bool matched = false;
+	for (auto pos = start; ; pos++)
+	{
+		if (!matched && (!full || pos == start))
+		{
+			if (current.size == 0 && this->_use_first_bytes && !full)
+			{
+				while (pos < size && !_contains(this->_first_bytes, (uint8_t)input[pos]))
+				{
+					pos++;
+				}
+
+				if (pos == size)
+				{
+					break;
+				}
+			}
+
+			std::fill(work.begin(), work.end(), std::string::npos);
+			_add_thread(this->_program, current, 0, input, pos, work.data(), stack);
+		}
+
+		if (current.size == 0 && (matched || full || pos >= size))
+		{
+			break;
+		}
+
+		auto c = pos < size ? (uint8_t)input[pos] : 0;
+		for (size_t i = 0; i < current.size; i++)
+		{
+			const auto& inst = this->_program[current.dense[i]];
+			bool step = false;
+			switch (inst.op)
+			{
+				case Op::Byte:
+					step = pos < size && c == inst.byte;
+					break;
+				case Op::Class:
+					step = pos < size && _contains(this->_classes[inst.x], c);
+					break;
+				case Op::Any:
+					step = pos < size && c != '\n' && c != '\r';
+					break;
+				case Op::Match:
+					if (full && pos != size)
+					{
+						continue;
+					}
+
+					matched = true;
+					matched_caps.assign(current.caps_of(i), current.caps_of(i) + caps_count);
+
+					// Threads with lower priority are cut off.
+					i = current.size;
+					continue;
+				default:
+					continue;
+			}
+
+			if (step)
+			{
+				std::copy(current.caps_of(i), current.caps_of(i) + caps_count, work.begin());
+				_add_thread(this->_program, next, current.dense[i] + 1, input, pos + 1, work.data(), stack);
+			}
+		}
+
+		std::swap(current, next);
+		next.size = 0;
+		if (pos >= size)
+		{
+			break;
+		}
+	}
+
+	if (matched && groups)
+	{
+		groups->resize(this->_groups_count + 1);
+		for (size_t i = 0; i <= this->_groups_count; i++)
+		{
+			auto begin = matched_caps[i * 2], end = matched_caps[i * 2 + 1];
+			if (begin == std::string::npos || end == std::string::npos)
+			{
+				(*groups)[i] = {std::string::npos, std::string::npos};
+			}
+			else
+			{
+				(*groups)[i] = {begin, end};
+			}
+		}
+	}
+
+	return matched;
+}
+
+__RE_END__
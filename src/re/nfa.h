@@ -0,0 +1,103 @@
+/**
+ * re/nfa.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Linear-time regular expression engine.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <array>
+#include <cstdint>
+#include <memory>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./engine.h"
+
+
+__RE_BEGIN__
+
+// Thompson NFA simulated with Pike VM: the input is scanned once and all
+// alternatives are tracked simultaneously, so the time is proportional to
+// the input size multiplied by the program size, and no recursion depends
+// on the input. Submatches follow the same priority rules as backtracking
+// ECMAScript engine. Memory for the simulation is kept per thread and
+// reused, so a run allocates only the first time a larger program runs.
+//
+// Supported syntax (ECMAScript subset, bytes are matched, not code points):
+//	literals and escaped special characters, '.', '^', '$', '\b', '\B',
+//	classes '[...]', '[^...]' with ranges, '\d', '\D', '\w', '\W', '\s', '\S',
+//	'\n', '\r', '\t', '\v', '\f', '\0', '\xHH',
+//	groups '(...)', '(?:...)', alternation '|',
+//	greedy and lazy quantifiers '*', '+', '?', '{n}', '{n,}', '{n,m}'.
+// Back references and lookaheads are not supported.
+class NfaEngine final : public IEngine
+{
+public:
+	enum class Op : uint8_t
+	{
+		Byte, Class, Any, Split, Jmp, Save, Bol, Eol, WordBoundary, NotWordBoundary, Match
+	};
+
+	struct Inst
+	{
+		Op op;
+		uint8_t byte;
+
+		// Target for 'Jmp' and preferred target for 'Split', slot
+		// for 'Save', index of class for 'Class'.
+		uint32_t x;
+
+		// Second target for 'Split'.
+		uint32_t y;
+	};
+
+	using ByteSet = std::array<uint64_t, 4>;
+
+private:
+	std::vector<Inst> _program;
+	std::vector<ByteSet> _classes;
+	size_t _groups_count = 0;
+
+	// Bytes which can start a match, used to skip the input when there
+	// are no running threads. Not used if a match can start with anything
+	// else than a byte.
+	ByteSet _first_bytes{};
+	bool _use_first_bytes = false;
+
+	NfaEngine() = default;
+
+	void _compute_first_bytes();
+
+	bool _run(std::string_view input, size_t start, bool full, std::vector<GroupOffsets>* groups) const;
+
+public:
+	// Compiles the pattern.
+	//
+	// Returns `nullptr` if the pattern is not supported.
+	static std::unique_ptr<NfaEngine> compile(const std::string& expr);
+
+	inline bool search(std::string_view input, size_t start, std::vector<GroupOffsets>& groups) const override
+	{
+		return this->_run(input, start, false, &groups);
+	}
+
+	[[nodiscard]]
+	inline bool match(std::string_view input) const override
+	{
+		return this->_run(input, 0, true, nullptr);
+	}
+
+	[[nodiscard]]
+	inline size_t groups_count() const override
+	{
+		return this->_groups_count;
+	}
+};
+
+__RE_END__
@@ -16,9 +16,8 @@ Regex& Regex::operator= (const Regex& other)
 {
 	if (this != &other)
 	{
-		this->_expr = other._expr;
+		this->_engine = other._engine;
 		this->_raw_expr = other._raw_expr;
-		this->_matches = other._matches;
 		this->_groups = other._groups;
 	}
 
@@ -28,23 +27,18 @@ Regex& Regex::operator= (const Regex& other)
 bool Regex::search(const std::string& s)
 {
 	this->_groups.clear();
-	auto start = s.cbegin();
-	bool is_found = false;
-	while (std::regex_search(start, s.cend(), this->_matches, this->_expr))
+	for (const auto& match : this->find_all(s))
 	{
-		for (const auto & match : this->_matches)
+		for (size_t i = 0; i < match.size(); i++)
 		{
-			if (match.matched)
+			if (match.matched(i))
 			{
-				this->_groups.push_back(match.str());
+				this->_groups.emplace_back(match.group(i));
 			}
 		}
-
-		start = this->_matches.suffix().first;
-		is_found = true;
 	}
 
-	return is_found;
+	return !this->_groups.empty();
 }
 
 std::string Regex::group(size_t pos) const
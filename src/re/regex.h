@@ -14,15 +14,21 @@
 // Module definitions.
 #include "./_def_.h"
 
+// Base libraries.
+#include "./cache.h"
+#include "./match.h"
+
 
 __RE_BEGIN__
 
+// The compiled pattern is immutable and shared, see `compile`. Const
+// methods can be called from many threads, `search` stores found groups
+// in the object and requires external synchronization.
 class Regex final
 {
 private:
-	std::regex _expr;
+	std::shared_ptr<const IEngine> _engine;
 	std::string _raw_expr;
-	std::smatch _matches;
 	std::vector<std::string> _groups;
 
 public:
@@ -35,9 +41,10 @@ public:
 	// Constructs regular expression from string.
 	//
 	// `expr`: regular expression pattern.
-	inline explicit Regex(const std::string& expr) : _raw_expr(expr)
+	// `engine`: engine to compile the pattern with.
+	inline explicit Regex(const std::string& expr, Engine engine=Engine::Auto) :
+		Regex(expr, std::regex_constants::ECMAScript, engine)
 	{
-		this->_expr = std::regex(expr);
 	}
 
 	// Constructs regular expression from string with
@@ -45,10 +52,12 @@ public:
 	//
 	// `expr`: regular expression pattern.
 	// `sot`: syntax options for regular expression.
-	inline explicit Regex(const std::string& expr, std::regex_constants::syntax_option_type type) :
-		_raw_expr(expr)
+	// `engine`: engine to compile the pattern with.
+	inline explicit Regex(
+		const std::string& expr, std::regex_constants::syntax_option_type type, Engine engine=Engine::Auto
+	) : _raw_expr(expr)
 	{
-		this->_expr = std::regex(expr, type);
+		this->_engine = compile(expr, type, engine);
 	}
 
 	// Copy assignment operator.
@@ -62,7 +71,7 @@ public:
 	[[nodiscard]]
 	inline bool match(const std::string& s) const
 	{
-		return std::regex_match(s, this->_expr);
+		return this->_engine->match(s);
 	}
 
 	// Searches for substrings in given string.
@@ -73,6 +82,38 @@ public:
 	// `false` otherwise.
 	bool search(const std::string& s);
 
+	// Searches for the first match in `s` beginning at `start`
+	// without copying the string.
+	//
+	// `s`: string to search, must outlive the result.
+	// `start`: offset to begin the search at.
+	//
+	// Returns the match, which is `false` if nothing is found.
+	[[nodiscard]]
+	inline Match find(std::string_view s, size_t start=0) const
+	{
+		Match result;
+		result._search(*this->_engine, s, start);
+		return result;
+	}
+
+	// Same as above, but reuses the storage of `result`.
+	//
+	// Returns `true` if the match is found, `false` otherwise.
+	inline bool find(std::string_view s, Match& result, size_t start=0) const
+	{
+		return result._search(*this->_engine, s, start);
+	}
+
+	// Returns a range over all non-overlapping matches in `s`.
+	//
+	// `s`: string to search, must outlive the range.
+	[[nodiscard]]
+	inline MatchRange find_all(std::string_view s) const
+	{
+		return {this->_engine, s};
+	}
+
 	// Returns found groups.
 	[[nodiscard]]
 	inline std::vector<std::string> groups() const
@@ -0,0 +1,471 @@
+/**
+ * re/route_set.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./route_set.h"
+
+// C++ libraries.
+#include <algorithm>
+#include <cstring>
+
+
+__RE_BEGIN__
+
+std::string_view RouteSet::Match::arg(std::string_view name, std::string_view default_val) const
+{
+	for (const auto& [key, value] : this->args)
+	{
+		if (key == name)
+		{
+			return value;
+		}
+	}
+
+	return default_val;
+}
+
+RouteSet::SegmentType segment_type(std::string_view regex)
+{
+	if (regex == R"(\d+)" || regex == "[0-9]+")
+	{
+		return RouteSet::SegmentType::Int;
+	}
+
+	if (regex == R"(\w+)")
+	{
+		return RouteSet::SegmentType::Word;
+	}
+
+	if (regex == R"([-\w]+)" || regex == R"([\w-]+)" || regex == "[-a-zA-Z0-9_]+" || regex == "[a-zA-Z0-9_-]+")
+	{
+		return RouteSet::SegmentType::Slug;
+	}
+
+	if (regex == "[^/]+")
+	{
+		return RouteSet::SegmentType::Segment;
+	}
+
+	if (regex == ".+")
+	{
+		return RouteSet::SegmentType::Path;
+	}
+
+	if (regex == "[0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12}")
+	{
+		return RouteSet::SegmentType::Uuid;
+	}
+
+	return RouteSet::SegmentType::Regex;
+}
+
+static inline bool _is_word_char(char c)
+{
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static inline bool _is_lower_hex(char c)
+{
+	return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+}
+
+// Returns the length of the longest prefix of `s` which can be matched
+// by argument of type `type`. Valid lengths are from 1 to the result,
+// except for uuid which has fixed length.
+static inline size_t _typed_prefix(RouteSet::SegmentType type, std::string_view s)
+{
+	size_t i = 0;
+	switch (type)
+	{
+		case RouteSet::SegmentType::Int:
+			while (i < s.size() && s[i] >= '0' && s[i] <= '9')
+			{
+				i++;
+			}
+			break;
+		case RouteSet::SegmentType::Word:
+			while (i < s.size() && _is_word_char(s[i]))
+			{
+				i++;
+			}
+			break;
+		case RouteSet::SegmentType::Slug:
+			while (i < s.size() && (_is_word_char(s[i]) || s[i] == '-'))
+			{
+				i++;
+			}
+			break;
+		case RouteSet::SegmentType::Segment:
+			while (i < s.size() && s[i] != '/')
+			{
+				i++;
+			}
+			break;
+		case RouteSet::SegmentType::Path:
+			while (i < s.size() && s[i] != '\n' && s[i] != '\r')
+			{
+				i++;
+			}
+			break;
+		case RouteSet::SegmentType::Uuid:
+			if (s.size() < 36)
+			{
+				return 0;
+			}
+
+			for (; i < 36; i++)
+			{
+				bool is_dash = i == 8 || i == 13 || i == 18 || i == 23;
+				if (is_dash ? s[i] != '-' : !_is_lower_hex(s[i]))
+				{
+					return 0;
+				}
+			}
+			break;
+		default:
+			break;
+	}
+
+	return i;
+}
+
+// Converts regular expression of a literal part to plain text.
+//
+// Returns `false` if the part contains regular expression syntax.
+static inline bool _unescape_literal(const std::string& regex, std::string& result)
+{
+	result.clear();
+	for (size_t i = 0; i < regex.size(); i++)
+	{
+		auto c = regex[i];
+		if (c == '\\')
+		{
+			if (i + 1 == regex.size() || _is_word_char(regex[i + 1]))
+			{
+				return false;
+			}
+
+			result += regex[++i];
+		}
+		else if (std::strchr(".^$|?*+()[]{}", c))
+		{
+			return false;
+		}
+		else
+		{
+			result += c;
+		}
+	}
+
+	return true;
+}
+
+void RouteSet::_insert(size_t index, const std::vector<_Item>& items)
+{
+	auto node = &this->_root;
+	node->min_route = std::min(node->min_route, index);
+	for (const auto& item : items)
+	{
+		if (item.is_arg)
+		{
+			auto it = std::find_if(node->captures.begin(), node->captures.end(), [&item](const auto& capture) {
+				return capture.source == item.text;
+			});
+			if (it == node->captures.end())
+			{
+				node->captures.push_back({segment_type(item.text), item.text, std::make_unique<_Node>()});
+				it = std::prev(node->captures.end());
+			}
+
+			node = it->next.get();
+			node->min_route = std::min(node->min_route, index);
+			continue;
+		}
+
+		std::string_view label = item.text;
+		while (!label.empty())
+		{
+			auto edge = std::find_if(node->edges.begin(), node->edges.end(), [label](const auto& e) {
+				return e.label[0] == label[0];
+			});
+			if (edge == node->edges.end())
+			{
+				node->edges.push_back({std::string(label), std::make_unique<_Node>()});
+				node = node->edges.back().next.get();
+				node->min_route = std::min(node->min_route, index);
+				break;
+			}
+
+			auto common = std::mismatch(
+				label.begin(), label.end(), edge->label.begin(), edge->label.end()
+			).first - label.begin();
+			if ((size_t)common < edge->label.size())
+			{
+				// Split the edge at the end of the common prefix.
+				auto middle = std::make_unique<_Node>();
+				middle->min_route = edge->next->min_route;
+				middle->edges.push_back({edge->label.substr(common), std::move(edge->next)});
+				edge->label.resize(common);
+				edge->next = std::move(middle);
+			}
+
+			node = edge->next.get();
+			node->min_route = std::min(node->min_route, index);
+			label.remove_prefix(common);
+		}
+	}
+
+	node->route = std::min(node->route, index);
+}
+
+size_t RouteSet::add(const std::string& pattern)
+{
+	enum class State
+	{
+		Str, CheckIfArg, ArgName, ArgRegex, Regex
+	};
+
+	auto index = this->_routes.size();
+	auto& route = this->_routes.emplace_back();
+	route.pattern = pattern;
+
+	// Parse the pattern the same way as 'ArgRegex' does.
+	std::vector<_Item> items;
+	bool is_plain = true;
+	std::string literal, arg_name, regex;
+	auto state = State::Str;
+	for (char ch : pattern)
+	{
+		switch (state)
+		{
+			case State::Str:
+				if (ch == '<')
+				{
+					state = State::CheckIfArg;
+				}
+				else if (ch == '(')
+				{
+					// Unnamed groups are not captured.
+					state = State::Regex;
+					literal += "(?:";
+					is_plain = false;
+				}
+				else
+				{
+					literal += ch;
+				}
+				break;
+			case State::CheckIfArg:
+				if (ch == '<')
+				{
+					literal += "<<";
+					state = State::Str;
+				}
+				else
+				{
+					arg_name += ch;
+					state = State::ArgName;
+				}
+				break;
+			case State::ArgName:
+				if (ch == '>')
+				{
+					state = State::ArgRegex;
+				}
+				else
+				{
+					arg_name += ch;
+				}
+				break;
+			case State::ArgRegex:
+				if (ch != '(')
+				{
+					// An argument without regular expression.
+					is_plain = false;
+					arg_name.clear();
+					literal += ch;
+					state = State::Str;
+					break;
+				}
+
+				items.push_back({false, "", literal});
+				literal.clear();
+				state = State::Regex;
+				break;
+			case State::Regex:
+				if (ch == ')')
+				{
+					if (arg_name.empty())
+					{
+						literal += ch;
+					}
+					else
+					{
+						route.keys.push_back(arg_name);
+						items.push_back({true, arg_name, regex});
+						arg_name.clear();
+						regex.clear();
+					}
+
+					state = State::Str;
+				}
+				else if (arg_name.empty())
+				{
+					literal += ch;
+				}
+				else
+				{
+					regex += ch;
+				}
+				break;
+		}
+	}
+
+	if (state != State::Str)
+	{
+		is_plain = false;
+	}
+
+	items.push_back({false, "", literal});
+
+	// Anchors are implied by full matching.
+	if (!items.front().text.empty() && items.front().text[0] == '^')
+	{
+		items.front().text.erase(0, 1);
+	}
+
+	auto& last = items.back().text;
+	if (!last.empty() && last.back() == '$' && (last.size() < 2 || last[last.size() - 2] != '\\'))
+	{
+		last.pop_back();
+	}
+
+	// Literals are replaced only if all of them are plain, the regex
+	// below is built from the original text otherwise. Arguments without
+	// typed extractor are matched with the whole pattern too, a single
+	// regex run is cheaper than trying every length of the argument.
+	std::vector<std::string> unescaped(items.size());
+	for (size_t i = 0; i < items.size() && is_plain; i++)
+	{
+		if (items[i].is_arg)
+		{
+			is_plain = segment_type(items[i].text) != SegmentType::Regex;
+		}
+		else
+		{
+			is_plain = _unescape_literal(items[i].text, unescaped[i]);
+		}
+	}
+
+	if (is_plain)
+	{
+		for (size_t i = 0; i < items.size(); i++)
+		{
+			if (!items[i].is_arg)
+			{
+				items[i].text = std::move(unescaped[i]);
+			}
+		}
+
+		this->_insert(index, items);
+	}
+	else
+	{
+		std::string full_regex;
+		for (const auto& item : items)
+		{
+			full_regex += item.is_arg ? "(" + item.text + ")" : item.text;
+		}
+
+		route.regex = std::make_unique<std::regex>(full_regex);
+		this->_regex_routes.push_back(index);
+	}
+
+	return index;
+}
+
+void RouteSet::_match(
+	const _Node* node, std::string_view rest,
+	std::vector<std::string_view>& values, size_t& best, std::vector<std::string_view>& best_values
+) const
+{
+	if (node->min_route >= best)
+	{
+		return;
+	}
+
+	if (rest.empty() && node->route < best)
+	{
+		best = node->route;
+		best_values = values;
+	}
+
+	for (const auto& edge : node->edges)
+	{
+		if (rest.size() >= edge.label.size() && rest.compare(0, edge.label.size(), edge.label) == 0)
+		{
+			this->_match(edge.next.get(), rest.substr(edge.label.size()), values, best, best_values);
+			break;
+		}
+	}
+
+	for (const auto& capture : node->captures)
+	{
+		auto max_size = _typed_prefix(capture.type, rest);
+		auto min_size = capture.type == SegmentType::Uuid ? max_size : 1;
+
+		// Try the longest value first, like greedy regular expression does.
+		for (auto size = max_size; size >= min_size && size > 0; size--)
+		{
+			values.push_back(rest.substr(0, size));
+			this->_match(capture.next.get(), rest.substr(size), values, best, best_values);
+			values.pop_back();
+		}
+	}
+}
+
+bool RouteSet::match(std::string_view path, Match& result) const
+{
+	result.index = std::string::npos;
+	result.args.clear();
+
+	auto best = std::string::npos;
+	std::vector<std::string_view> values, best_values;
+	this->_match(&this->_root, path, values, best, best_values);
+	for (auto index : this->_regex_routes)
+	{
+		if (index >= best)
+		{
+			break;
+		}
+
+		std::match_results<std::string_view::const_iterator> matches;
+		if (std::regex_match(path.begin(), path.end(), matches, *this->_routes[index].regex))
+		{
+			best = index;
+			best_values.clear();
+			for (size_t i = 1; i < matches.size(); i++)
+			{
+				best_values.emplace_back(path.data() + (matches[i].first - path.begin()), matches[i].length());
+			}
+		}
+	}
+
+	if (best == std::string::npos)
+	{
+		return false;
+	}
+
+	result.index = best;
+	const auto& keys = this->_routes[best].keys;
+	for (size_t i = 0; i < keys.size() && i < best_values.size(); i++)
+	{
+		result.args.emplace_back(keys[i], best_values[i]);
+	}
+
+	return true;
+}
+
+__RE_END__
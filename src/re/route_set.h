@@ -0,0 +1,161 @@
+/**
+ * re/route_set.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Set of `ArgRegex` patterns compiled into a single matcher.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <deque>
+#include <memory>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+
+__RE_BEGIN__
+
+// Matches a path against many `ArgRegex` patterns at once.
+//
+// Patterns are split into literal parts and `<name>(regex)` arguments
+// and inserted into a radix tree. Arguments with well-known regular
+// expressions are matched by typed extractors:
+//	int:     \d+, [0-9]+
+//	word:    \w+
+//	slug:    [-\w]+, [\w-]+, [-a-zA-Z0-9_]+, [a-zA-Z0-9_-]+
+//	segment: [^/]+
+//	path:    .+
+//	uuid:    [0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12}
+// A pattern with other arguments or with regular expression syntax
+// outside of arguments is matched as a whole with `std::regex`.
+//
+// Unlike `ArgRegex::search`, the whole path must match the pattern. If
+// the path matches several patterns, the one which was added first wins.
+class RouteSet final
+{
+public:
+	enum class SegmentType
+	{
+		Int, Word, Slug, Segment, Path, Uuid, Regex
+	};
+
+	// Result of matching.
+	//
+	// `index`: index of the matched pattern as returned by `add(...)`.
+	// `args`: names and values of arguments in order of appearance in
+	// the pattern. Names point to the route set, values point to the
+	// matched path.
+	struct Match
+	{
+		size_t index = std::string::npos;
+		std::vector<std::pair<std::string_view, std::string_view>> args;
+
+		// Returns the value of argument by its name or `default_val`
+		// if the argument does not exist.
+		[[nodiscard]]
+		std::string_view arg(std::string_view name, std::string_view default_val={}) const;
+	};
+
+private:
+	struct _Node;
+
+	// Parsed part of pattern: literal text or argument.
+	struct _Item
+	{
+		bool is_arg;
+		std::string name;
+		std::string text;
+	};
+
+	struct _Capture
+	{
+		SegmentType type;
+
+		// Regular expression of the argument, used to share
+		// nodes between patterns.
+		std::string source;
+		std::unique_ptr<_Node> next;
+	};
+
+	struct _Edge
+	{
+		std::string label;
+		std::unique_ptr<_Node> next;
+	};
+
+	struct _Node
+	{
+		std::vector<_Edge> edges;
+		std::vector<_Capture> captures;
+
+		// Index of the pattern which ends at this node.
+		size_t route = std::string::npos;
+
+		// The smallest index of pattern in this subtree.
+		size_t min_route = std::string::npos;
+	};
+
+	struct _Route
+	{
+		std::string pattern;
+		std::vector<std::string> keys;
+
+		// Set for patterns which can not be compiled to the tree.
+		std::unique_ptr<std::regex> regex;
+	};
+
+	_Node _root;
+
+	// Deque does not move elements, so views of keys remain valid.
+	std::deque<_Route> _routes;
+	std::vector<size_t> _regex_routes;
+
+	void _insert(size_t index, const std::vector<_Item>& items);
+
+	void _match(
+		const _Node* node, std::string_view rest,
+		std::vector<std::string_view>& values, size_t& best, std::vector<std::string_view>& best_values
+	) const;
+
+public:
+	RouteSet() = default;
+
+	// Adds `ArgRegex` pattern to the set.
+	//
+	// Returns index of the pattern.
+	size_t add(const std::string& pattern);
+
+	// Matches `path` against all patterns.
+	//
+	// `path`: string to match, must outlive the result.
+	// `result`: target match, it is cleared before matching.
+	//
+	// Returns `true` if any pattern matches the path, `false` otherwise.
+	bool match(std::string_view path, Match& result) const;
+
+	// Returns the number of patterns.
+	[[nodiscard]]
+	inline size_t size() const
+	{
+		return this->_routes.size();
+	}
+
+	// Returns the original pattern by its index.
+	[[nodiscard]]
+	inline const std::string& pattern(size_t index) const
+	{
+		return this->_routes.at(index).pattern;
+	}
+};
+
+// Returns the type of extractor for the argument's regular expression.
+extern RouteSet::SegmentType segment_type(std::string_view regex);
+
+__RE_END__
@@ -18,23 +18,43 @@
 
 __STR_BEGIN__
 
+// Multiplies `value` by 10 to the power of `exponent` in at most two
+// steps, so the result is rounded once for exponents up to 22.
+static inline double _scale10(double value, int exponent)
+{
+	if (exponent > 300 || exponent < -300)
+	{
+		value = _scale10(value, exponent / 2);
+		exponent -= exponent / 2;
+	}
+
+	return exponent >= 0 ? value * std::pow(10.0, exponent) : value / std::pow(10.0, -exponent);
+}
+
 int _normalize_exp(double* val)
 {
-	int exponent = 0;
 	double value = *val;
-	while (value >= 1.0)
+	if (!(value > 0.0) || !std::isfinite(value))
 	{
-		value /= 10.0;
-		++exponent;
+		return 0;
 	}
 
-	while (value < 0.1)
+	auto exponent = (int)std::floor(std::log10(value)) + 1;
+	auto result = _scale10(value, -exponent);
+
+	// Logarithm can be off by one near powers of ten.
+	if (result >= 1.0)
+	{
+		exponent++;
+		result = _scale10(value, -exponent);
+	}
+	else if (result < 0.1)
 	{
-		value *= 10.0;
-		--exponent;
+		exponent--;
+		result = _scale10(value, -exponent);
 	}
 
-	*val = value;
+	*val = result;
 	return exponent;
 }
 
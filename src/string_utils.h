@@ -9,6 +9,9 @@
 #pragma once
 
 // C++ libraries.
+#include <charconv>
+#include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 #include <functional>
@@ -37,8 +40,55 @@ static constexpr size_t npos = -1;
 //
 // case 2: input value is 0.000256, the `val` will
 // become 0.256 and an exponent will be -3.
+//
+// Zero, negative and non-finite values are not changed and the
+// exponent is 0.
 extern int _normalize_exp(double* val);
 
+// Formats integer or floating-point `value` with `std::to_chars`, which
+// does not depend on locale. Floating-point values are written in fixed
+// notation with the shortest digits which convert back to the same
+// value and always have a decimal point, for example "2.0" or "0.1".
+template <typename T>
+requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>)
+inline std::string number_to_string(T value)
+{
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		char buffer[64];
+		auto [end, error] = std::to_chars(buffer, buffer + sizeof buffer, value, std::chars_format::fixed);
+		std::string result;
+		if (error == std::errc())
+		{
+			result.assign(buffer, end);
+		}
+		else
+		{
+			// Very large or very small values take hundreds of digits.
+			result.resize(
+				std::numeric_limits<T>::max_exponent10 - std::numeric_limits<T>::min_exponent10 +
+				std::numeric_limits<T>::max_digits10 + 8
+			);
+			auto r = std::to_chars(result.data(), result.data() + result.size(), value, std::chars_format::fixed);
+			result.resize(r.ptr - result.data());
+		}
+
+		if (std::isfinite(value) && result.find('.') == std::string::npos)
+		{
+			result += ".0";
+		}
+
+		return result;
+	}
+	else
+	{
+		using IntegerT = std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>;
+		char buffer[24];
+		auto end = std::to_chars(buffer, buffer + sizeof buffer, (IntegerT)value).ptr;
+		return std::string(buffer, end);
+	}
+}
+
 // Joins list of items using lambda function to convert
 // item to std::string.
 //
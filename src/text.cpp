@@ -9,14 +9,120 @@
 
 __TEXT_BEGIN__
 
+// Same as '\s' in 'std::regex'.
+static inline bool _is_space(char c)
+{
+	return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static inline bool _is_quote(char c)
+{
+	return c == '"' || c == '\'';
+}
+
+size_t SmartSplit::_skip_quoted(size_t begin) const
+{
+	auto quote = this->_text[begin];
+	for (auto i = begin + 1; i < this->_text.size(); i++)
+	{
+		auto c = this->_text[i];
+		if (c == quote)
+		{
+			return i + 1;
+		}
+
+		if (c == '\\')
+		{
+			// The escaped character can be anything except line terminators.
+			if (i + 1 == this->_text.size() || this->_text[i + 1] == '\n' || this->_text[i + 1] == '\r')
+			{
+				return std::string::npos;
+			}
+
+			i++;
+		}
+	}
+
+	return std::string::npos;
+}
+
+bool SmartSplit::next(std::string_view& token)
+{
+	auto size = this->_text.size();
+	auto begin = this->_position;
+	while (begin < size && _is_space(this->_text[begin]))
+	{
+		begin++;
+	}
+
+	if (begin == size)
+	{
+		this->_position = size;
+		return false;
+	}
+
+	// A word which contains at least one closed quoted string. Parts
+	// outside quotes cannot contain spaces or quotes.
+	auto end = begin;
+	bool has_quoted = false;
+	while (true)
+	{
+		while (end < size && !_is_space(this->_text[end]) && !_is_quote(this->_text[end]))
+		{
+			end++;
+		}
+
+		if (end == size || !_is_quote(this->_text[end]))
+		{
+			break;
+		}
+
+		auto quoted_end = this->_skip_quoted(end);
+		if (quoted_end == std::string::npos)
+		{
+			break;
+		}
+
+		end = quoted_end;
+		has_quoted = true;
+	}
+
+	if (!has_quoted)
+	{
+		// Any run of non-space characters.
+		end = begin;
+		while (end < size && !_is_space(this->_text[end]))
+		{
+			end++;
+		}
+	}
+
+	token = this->_text.substr(begin, end - begin);
+	this->_position = end;
+	return true;
+}
+
 std::vector<std::string> smart_split(const std::string& text)
 {
-	auto smart_split_regex = SMART_SPLIT_REGEX;
 	std::vector<std::string> result;
-	smart_split_regex.setup(text);
-	while (smart_split_regex.search_next())
+	SmartSplit tokenizer(text);
+	std::string_view token;
+	while (tokenizer.next(token))
+	{
+		result.emplace_back(token);
+	}
+
+	return result;
+}
+
+std::vector<std::string_view> smart_split_views(std::string_view text)
+{
+	std::vector<std::string_view> result;
+	SmartSplit tokenizer(text);
+	std::string_view token;
+	while (tokenizer.next(token))
 	{
-		result.push_back(smart_split_regex.group(0));
+		result.push_back(token);
 	}
 
 	return result;
@@ -22,6 +22,33 @@ const inline re::IterRegex SMART_SPLIT_REGEX(
 	std::regex_constants::optimize
 );
 
+// Single-pass tokenizer with the same semantics as `SMART_SPLIT_REGEX`.
+// Tokens are views into the input string, so the input must outlive
+// them.
+class SmartSplit final
+{
+private:
+	std::string_view _text;
+	size_t _position = 0;
+
+	// Returns the position past the closing quote of the quoted string
+	// which starts at `begin`, or `npos` if the string is not closed.
+	[[nodiscard]]
+	size_t _skip_quoted(size_t begin) const;
+
+public:
+	inline explicit SmartSplit(std::string_view text) : _text(text)
+	{
+	}
+
+	// Finds the next token.
+	//
+	// `token`: receives the token.
+	//
+	// Returns `false` if there are no more tokens.
+	bool next(std::string_view& token);
+};
+
 // Splits a string by spaces, leaving quoted phrases together.
 // Supports both single and double quotes, and supports escaping quotes with
 // backslashes. In the output, strings will keep their initial and trailing
@@ -33,4 +60,7 @@ const inline re::IterRegex SMART_SPLIT_REGEX(
 // empty vector.
 extern std::vector<std::string> smart_split(const std::string& text);
 
+// Same as `smart_split`, but returns views into `text`.
+extern std::vector<std::string_view> smart_split_views(std::string_view text);
+
 __TEXT_END__
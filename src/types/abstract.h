@@ -8,6 +8,12 @@
 
 #pragma once
 
+// C++ libraries.
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+
 // Module definitions.
 #include "./_def_.h"
 
@@ -42,6 +48,201 @@ public:
 	}
 };
 
+// Objects stored in contiguous memory with fixed distance between them,
+// for example derived objects in `std::vector`. Iterating over it does
+// not call virtual functions.
+class ObjectSpan
+{
+private:
+	const char* _data = nullptr;
+	size_t _size = 0;
+	size_t _stride = 0;
+
+public:
+	class iterator
+	{
+	private:
+		const char* _ptr = nullptr;
+		size_t _stride = 0;
+
+	public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type = obj::Object;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const obj::Object*;
+		using reference = const obj::Object&;
+
+		iterator() = default;
+
+		inline iterator(const char* ptr, size_t stride) : _ptr(ptr), _stride(stride)
+		{
+		}
+
+		inline reference operator* () const
+		{
+			return *reinterpret_cast<pointer>(this->_ptr);
+		}
+
+		inline pointer operator-> () const
+		{
+			return reinterpret_cast<pointer>(this->_ptr);
+		}
+
+		inline reference operator[] (difference_type n) const
+		{
+			return *(*this + n);
+		}
+
+		inline iterator& operator++ ()
+		{
+			this->_ptr += this->_stride;
+			return *this;
+		}
+
+		inline iterator operator++ (int)
+		{
+			auto copy = *this;
+			++*this;
+			return copy;
+		}
+
+		inline iterator& operator-- ()
+		{
+			this->_ptr -= this->_stride;
+			return *this;
+		}
+
+		inline iterator operator-- (int)
+		{
+			auto copy = *this;
+			--*this;
+			return copy;
+		}
+
+		inline iterator& operator+= (difference_type n)
+		{
+			this->_ptr += n * (difference_type)this->_stride;
+			return *this;
+		}
+
+		inline iterator& operator-= (difference_type n)
+		{
+			return *this += -n;
+		}
+
+		inline iterator operator+ (difference_type n) const
+		{
+			auto copy = *this;
+			return copy += n;
+		}
+
+		inline friend iterator operator+ (difference_type n, const iterator& it)
+		{
+			return it + n;
+		}
+
+		inline iterator operator- (difference_type n) const
+		{
+			auto copy = *this;
+			return copy -= n;
+		}
+
+		inline difference_type operator- (const iterator& other) const
+		{
+			return this->_stride ? (this->_ptr - other._ptr) / (difference_type)this->_stride : 0;
+		}
+
+		inline bool operator== (const iterator& other) const
+		{
+			return this->_ptr == other._ptr;
+		}
+
+		inline bool operator!= (const iterator& other) const
+		{
+			return this->_ptr != other._ptr;
+		}
+
+		inline bool operator< (const iterator& other) const
+		{
+			return this->_ptr < other._ptr;
+		}
+
+		inline bool operator> (const iterator& other) const
+		{
+			return this->_ptr > other._ptr;
+		}
+
+		inline bool operator<= (const iterator& other) const
+		{
+			return this->_ptr <= other._ptr;
+		}
+
+		inline bool operator>= (const iterator& other) const
+		{
+			return this->_ptr >= other._ptr;
+		}
+	};
+
+	using reverse_iterator = std::reverse_iterator<iterator>;
+
+	ObjectSpan() = default;
+
+	// `first`: the first object, `size`: the number of objects,
+	// `stride`: distance in bytes between objects.
+	inline ObjectSpan(const obj::Object* first, size_t size, size_t stride) :
+		_data(reinterpret_cast<const char*>(first)), _size(size), _stride(stride)
+	{
+	}
+
+	// Makes span of `size` objects of type `T` starting at `first`.
+	template <typename T>
+	static inline ObjectSpan of(const T* first, size_t size)
+	{
+		return size ? ObjectSpan(static_cast<const obj::Object*>(first), size, sizeof(T)) : ObjectSpan();
+	}
+
+	[[nodiscard]]
+	inline size_t size() const
+	{
+		return this->_size;
+	}
+
+	[[nodiscard]]
+	inline bool empty() const
+	{
+		return this->_size == 0;
+	}
+
+	inline const obj::Object& operator[] (size_t i) const
+	{
+		return *reinterpret_cast<const obj::Object*>(this->_data + i * this->_stride);
+	}
+
+	[[nodiscard]]
+	inline iterator begin() const
+	{
+		return iterator(this->_data, this->_stride);
+	}
+
+	[[nodiscard]]
+	inline iterator end() const
+	{
+		return iterator(this->_data + this->_size * this->_stride, this->_stride);
+	}
+
+	[[nodiscard]]
+	inline reverse_iterator rbegin() const
+	{
+		return reverse_iterator(this->end());
+	}
+
+	[[nodiscard]]
+	inline reverse_iterator rend() const
+	{
+		return reverse_iterator(this->begin());
+	}
+};
+
 // Base class for sequential containers.
 class SequenceContainer : public Iterable
 {
@@ -63,6 +264,15 @@ public:
 	virtual void look_through(
 		const std::function<void(size_t, const obj::Object*)>& func, bool reversed
 	) const = 0;
+
+	// Returns values if they are stored contiguously, so they can be
+	// iterated without calling a function per value. Otherwise returns
+	// nothing and `look_through` must be used.
+	[[nodiscard]]
+	inline virtual std::optional<ObjectSpan> objects() const
+	{
+		return std::nullopt;
+	}
 };
 
 // Base class for map containers.
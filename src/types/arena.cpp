@@ -0,0 +1,55 @@
+/**
+ * types/arena.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./arena.h"
+
+// C++ libraries.
+#include <cassert>
+
+
+__TYPES_BEGIN__
+
+void* Arena::do_allocate(size_t bytes, size_t alignment)
+{
+	auto result = this->buffer.allocate(bytes, alignment);
+	this->live_count++;
+	return result;
+}
+
+void Arena::do_deallocate(void*, size_t, size_t)
+{
+	// Memory is returned in `release`.
+	this->live_count--;
+}
+
+bool Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+Arena::Arena(size_t initial_size, std::pmr::memory_resource* upstream) : buffer(initial_size, upstream)
+{
+}
+
+Arena::~Arena()
+{
+	assert(this->live_count == 0 && "objects allocated from the arena are still alive");
+}
+
+void Arena::release()
+{
+	if (auto live = this->live_count.load())
+	{
+		throw RuntimeError(
+			"unable to release arena, " + std::to_string(live) + " allocations are alive",
+			_ERROR_DETAILS_
+		);
+	}
+
+	this->buffer.release();
+}
+
+__TYPES_END__
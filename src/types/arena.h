@@ -0,0 +1,97 @@
+/**
+ * types/arena.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Memory arena for values which live during a single render.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./abstract.h"
+
+
+__TYPES_BEGIN__
+
+// `std::pmr::memory_resource` which hands out memory from large blocks
+// and frees all of it at once. Objects made by `make` keep the object
+// and the control block of `std::shared_ptr` in one allocation from the
+// arena, so creating them does not call the global allocator.
+//
+// The arena is meant for one render: create it, build the context, render
+// and destroy it. All objects allocated from it must be destroyed before
+// the arena is released or destroyed. Allocation is not thread-safe, but
+// the objects can be read and their last references dropped in several
+// threads.
+class Arena : public std::pmr::memory_resource
+{
+protected:
+	std::pmr::monotonic_buffer_resource buffer;
+	std::atomic<size_t> live_count = 0;
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+
+	void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+	[[nodiscard]]
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+
+	// `initial_size`: size of the first block in bytes, next blocks grow
+	// geometrically.
+	// `upstream`: resource which allocates the blocks.
+	explicit Arena(
+		size_t initial_size=4096, std::pmr::memory_resource* upstream=std::pmr::new_delete_resource()
+	);
+
+	Arena(const Arena&) = delete;
+
+	Arena& operator= (const Arena&) = delete;
+
+	// All objects allocated from the arena must be destroyed, it is
+	// checked by `assert`.
+	~Arena() override;
+
+	// Makes `T` in the arena.
+	template <object_based_type T, typename ...ArgsT>
+	inline std::shared_ptr<T> make(ArgsT&& ...args)
+	{
+		return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(this), std::forward<ArgsT>(args)...);
+	}
+
+	// Returns the number of allocations which are not deallocated yet.
+	[[nodiscard]]
+	inline size_t live() const
+	{
+		return this->live_count;
+	}
+
+	// Returns all memory to the upstream resource, so the arena can be
+	// reused for the next render.
+	//
+	// Throws `RuntimeError` if some objects are still alive.
+	void release();
+};
+
+// Makes values with `std::make_shared`. Has the same interface as
+// `Arena`, so conversions can use either of them.
+struct HeapAllocator
+{
+	template <object_based_type T, typename ...ArgsT>
+	inline std::shared_ptr<T> make(ArgsT&& ...args) const
+	{
+		return std::make_shared<T>(std::forward<ArgsT>(args)...);
+	}
+};
+
+__TYPES_END__
@@ -0,0 +1,133 @@
+/**
+ * types/atom.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./atom.h"
+
+// C++ libraries.
+#include <array>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+// Base libraries.
+#include "./string.h"
+
+
+__TYPES_BEGIN__
+
+// The table is split into shards by hash, so threads interning
+// different strings rarely wait for each other. Lookups of strings
+// which are already interned take a shared lock.
+struct _AtomShard
+{
+	std::shared_mutex mutex;
+	std::unordered_map<std::string_view, std::unique_ptr<Atom::Entry>> entries;
+};
+
+static constexpr size_t _ATOM_SHARDS_COUNT = 16;
+
+static std::array<_AtomShard, _ATOM_SHARDS_COUNT>& _atom_shards()
+{
+	// Never destroyed, so atoms can be used in destructors of other
+	// static objects.
+	static auto shards = new std::array<_AtomShard, _ATOM_SHARDS_COUNT>();
+	return *shards;
+}
+
+const Atom::Entry* Atom::intern(std::string_view s, bool is_static)
+{
+	auto hash = std::hash<std::string_view>{}(s);
+	auto& shard = _atom_shards()[(hash >> 7) % _ATOM_SHARDS_COUNT];
+	{
+		std::shared_lock lock(shard.mutex);
+		auto it = shard.entries.find(s);
+		if (it != shard.entries.end())
+		{
+			return it->second.get();
+		}
+	}
+
+	std::unique_lock lock(shard.mutex);
+	auto it = shard.entries.find(s);
+	if (it != shard.entries.end())
+	{
+		return it->second.get();
+	}
+
+	auto entry = std::make_unique<Entry>();
+	entry->hash = hash;
+	if (is_static)
+	{
+		entry->value = s;
+	}
+	else
+	{
+		entry->storage = std::string(s);
+		entry->value = entry->storage;
+	}
+
+	auto result = entry.get();
+	shard.entries.emplace(result->value, std::move(entry));
+	return result;
+}
+
+Atom::Atom() : entry(Atom::intern("", true))
+{
+}
+
+size_t Atom::table_size()
+{
+	size_t result = 0;
+	for (auto& shard : _atom_shards())
+	{
+		std::shared_lock lock(shard.mutex);
+		result += shard.entries.size();
+	}
+
+	return result;
+}
+
+std::string Atom::__repr__() const
+{
+	std::string result;
+	result.reserve(this->entry->value.size() + 2);
+	result += '"';
+	result += this->entry->value;
+	result += '"';
+	return result;
+}
+
+short Atom::__cmp__(const Object* other) const
+{
+	std::string_view other_value;
+	if (auto other_atom = dynamic_cast<const Atom*>(other))
+	{
+		if (this->entry == other_atom->entry)
+		{
+			return 0;
+		}
+
+		other_value = other_atom->entry->value;
+	}
+	else if (auto other_string = dynamic_cast<const String*>(other))
+	{
+		other_value = other_string->get();
+	}
+	else
+	{
+		throw TypeError(
+			"'__cmp__' not supported between instances of '" + this->__type__().name() +
+				"' and '" + other->__type__().name() + "'",
+			_ERROR_DETAILS_
+		);
+	}
+
+	auto result = this->entry->value.compare(other_value);
+	return result < 0 ? -1 : (result > 0 ? 1 : 0);
+}
+
+__TYPES_END__
@@ -0,0 +1,167 @@
+/**
+ * types/atom.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Interned immutable string for rendering it in templates.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <functional>
+#include <string>
+#include <string_view>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "../object/object.h"
+
+
+__TYPES_BEGIN__
+
+// Immutable string stored once per process in a global table. Copying
+// an atom copies a pointer, equal atoms have the same pointer, and the
+// hash is computed once on interning, so atoms suit context keys and
+// other values which repeat many times.
+//
+// Interned strings are never freed, so atoms must not be made of
+// unbounded sets of strings, for example of user input.
+class Atom final : public obj::Object
+{
+public:
+	struct Entry
+	{
+		std::string_view value;
+		size_t hash;
+
+		// Owns the characters unless the atom references static storage.
+		std::string storage;
+	};
+
+protected:
+	const Entry* entry;
+
+	static const Entry* intern(std::string_view s, bool is_static);
+
+	inline explicit Atom(const Entry* e) : entry(e)
+	{
+	}
+
+public:
+
+	// Makes atom of empty string.
+	Atom();
+
+	// Interns a copy of `s`. Safe to call from several threads.
+	inline explicit Atom(std::string_view s) : entry(Atom::intern(s, false))
+	{
+	}
+
+	// Interns `s` without copying it if the string is not interned yet.
+	// `s` must have static storage duration, for example be a literal.
+	static inline Atom from_static(std::string_view s)
+	{
+		return Atom(Atom::intern(s, true));
+	}
+
+	// Returns the number of interned strings.
+	static size_t table_size();
+
+	[[nodiscard]]
+	inline std::string_view view() const
+	{
+		return this->entry->value;
+	}
+
+	// Returns the hash of the string, the same as `std::hash` of
+	// `std::string_view` and of `String` with the same characters.
+	[[nodiscard]]
+	inline size_t hash() const
+	{
+		return this->entry->hash;
+	}
+
+	[[nodiscard]]
+	inline size_t size() const
+	{
+		return this->entry->value.size();
+	}
+
+	// Returns the string.
+	[[nodiscard]]
+	inline std::string __str__() const override
+	{
+		return std::string(this->entry->value);
+	}
+
+	// Returns the string wrapped with quotes.
+	[[nodiscard]]
+	std::string __repr__() const override;
+
+	// Compares with `Atom` or `String`.
+	//
+	// Throws `TypeError` if `other` has different type.
+	[[nodiscard]]
+	short __cmp__(const Object* other) const override;
+
+	// Returns `true` if the string is not empty, `false` otherwise.
+	inline explicit operator bool () const override
+	{
+		return !this->entry->value.empty();
+	}
+
+	// Returns `true` if the string is empty, `false` otherwise.
+	inline bool operator! () const override
+	{
+		return this->entry->value.empty();
+	}
+
+	// Compares pointers to interned strings.
+	inline bool operator== (const Atom& other) const
+	{
+		return this->entry == other.entry;
+	}
+
+	inline bool operator!= (const Atom& other) const
+	{
+		return this->entry != other.entry;
+	}
+
+	// Orders by characters, so atoms can be keys of sorted maps.
+	inline bool operator< (const Atom& other) const
+	{
+		return this->entry != other.entry && this->entry->value < other.entry->value;
+	}
+
+	inline bool operator<= (const Atom& other) const
+	{
+		return !(other < *this);
+	}
+
+	inline bool operator> (const Atom& other) const
+	{
+		return other < *this;
+	}
+
+	inline bool operator>= (const Atom& other) const
+	{
+		return !(*this < other);
+	}
+};
+
+using atom = Atom;
+
+__TYPES_END__
+
+
+template <>
+struct std::hash<xw::types::Atom>
+{
+	inline size_t operator()(const xw::types::Atom& a) const noexcept
+	{
+		return a.hash();
+	}
+};
@@ -96,6 +96,13 @@ public:
 		return false;
 	}
 
+	// Returns an internal `DateTimeT` value.
+	[[nodiscard]]
+	inline const DateTimeT& get() const
+	{
+		return this->value;
+	}
+
 	// Returns an address to internal `dt::Date` object.
 	inline dt::Date& operator* ()
 	{
@@ -0,0 +1,294 @@
+/**
+ * types/flat_map.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Map stored in a sorted vector for rendering in templates.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./abstract.h"
+
+
+__TYPES_BEGIN__
+
+// Entries are stored in a vector sorted by key. Lookups are a binary
+// search over contiguous memory, and insertions and removals are O(n),
+// which suits small maps built once and read many times. Iteration
+// order is the same as of `Map`.
+template <object_based_type KeyT, object_based_type ValueT>
+class FlatMap : public obj::Object, public MapContainer
+{
+public:
+	typedef KeyT key_type;
+	typedef ValueT value_type;
+	typedef std::pair<KeyT, ValueT> entry_type;
+	typedef std::vector<entry_type> container_type;
+	typedef typename container_type::const_iterator const_iterator;
+	typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+
+protected:
+	container_type entries;
+
+	[[nodiscard]]
+	inline typename container_type::const_iterator lower_bound(const KeyT& key) const
+	{
+		return std::lower_bound(
+			this->entries.begin(), this->entries.end(), key,
+			[](const entry_type& entry, const KeyT& k) -> bool { return entry.first < k; }
+		);
+	}
+
+	[[nodiscard]]
+	inline bool is_key_at(typename container_type::const_iterator it, const KeyT& key) const
+	{
+		return it != this->entries.end() && !(key < it->first);
+	}
+
+	// Sorts entries by key keeping the first value of repeated key.
+	inline void sort_unique()
+	{
+		std::stable_sort(
+			this->entries.begin(), this->entries.end(),
+			[](const entry_type& left, const entry_type& right) -> bool { return left.first < right.first; }
+		);
+		auto end = std::unique(
+			this->entries.begin(), this->entries.end(),
+			[](const entry_type& left, const entry_type& right) -> bool { return !(left.first < right.first); }
+		);
+		this->entries.erase(end, this->entries.end());
+	}
+
+	// Formats entries using __repr__() of keys and values.
+	[[nodiscard]]
+	inline std::string aggregate() const
+	{
+		std::string result = "{";
+		for (auto it = this->entries.begin(); it != this->entries.end(); it++)
+		{
+			if (it != this->entries.begin())
+			{
+				result += ", ";
+			}
+
+			result += "{" + it->first.__repr__() + ", " + it->second.__repr__() + "}";
+		}
+
+		return result + "}";
+	}
+
+public:
+	// Default constructor.
+	inline explicit FlatMap() = default;
+
+	// Constructs FlatMap from entries in any order. The first value of
+	// repeated key is kept.
+	inline explicit FlatMap(container_type value) : entries(std::move(value))
+	{
+		this->sort_unique();
+	}
+
+	// Constructs FlatMap from initializer list. The first value of
+	// repeated key is kept.
+	inline FlatMap(std::initializer_list<entry_type> list) : entries(list)
+	{
+		this->sort_unique();
+	}
+
+	inline void reserve(size_t count)
+	{
+		this->entries.reserve(count);
+	}
+
+	// Inserts the entry if `key` is not in the map.
+	//
+	// Returns `true` if the entry is inserted.
+	inline bool insert(KeyT key, ValueT value)
+	{
+		auto it = this->lower_bound(key);
+		if (this->is_key_at(it, key))
+		{
+			return false;
+		}
+
+		this->entries.emplace(it, std::move(key), std::move(value));
+		return true;
+	}
+
+	// Inserts the entry or replaces the value of existing `key`.
+	//
+	// Returns `true` if the entry is inserted.
+	inline bool insert_or_assign(KeyT key, ValueT value)
+	{
+		auto it = this->lower_bound(key);
+		if (this->is_key_at(it, key))
+		{
+			this->entries[it - this->entries.begin()].second = std::move(value);
+			return false;
+		}
+
+		this->entries.emplace(it, std::move(key), std::move(value));
+		return true;
+	}
+
+	// Removes the entry of `key`.
+	//
+	// Returns `true` if the entry is removed.
+	inline bool erase(const KeyT& key)
+	{
+		auto it = this->lower_bound(key);
+		if (!this->is_key_at(it, key))
+		{
+			return false;
+		}
+
+		this->entries.erase(it);
+		return true;
+	}
+
+	// Returns pointer to the value of `key` or `nullptr`.
+	[[nodiscard]]
+	inline const ValueT* find(const KeyT& key) const
+	{
+		auto it = this->lower_bound(key);
+		return this->is_key_at(it, key) ? &it->second : nullptr;
+	}
+
+	[[nodiscard]]
+	inline bool contains(const KeyT& key) const
+	{
+		return this->find(key) != nullptr;
+	}
+
+	// Returns the value of `key`.
+	//
+	// Throws `KeyError` if `key` is not in the map.
+	[[nodiscard]]
+	inline const ValueT& at(const KeyT& key) const
+	{
+		if (auto value = this->find(key))
+		{
+			return *value;
+		}
+
+		throw KeyError(key.__repr__(), _ERROR_DETAILS_);
+	}
+
+	// Iterators over entries sorted by key.
+	[[nodiscard]]
+	inline const_iterator begin() const
+	{
+		return this->entries.begin();
+	}
+
+	[[nodiscard]]
+	inline const_iterator end() const
+	{
+		return this->entries.end();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rbegin() const
+	{
+		return this->entries.rbegin();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rend() const
+	{
+		return this->entries.rend();
+	}
+
+	// Iterates through map container in given direction.
+	//
+	// `func`: function which handles key, value and index.
+	// `reversed`: iteration direction option.
+	inline void look_through(
+		const std::function<void(size_t, const obj::Object*, const obj::Object*)>& func, bool reversed
+	) const override
+	{
+		size_t i = 0;
+		if (reversed)
+		{
+			for (auto it = this->entries.rbegin(); it != this->entries.rend(); it++)
+			{
+				func(i++, &it->first, &it->second);
+			}
+		}
+		else
+		{
+			for (const auto& entry : this->entries)
+			{
+				func(i++, &entry.first, &entry.second);
+			}
+		}
+	}
+
+	// Returns `true` if container is empty, `false` otherwise.
+	[[nodiscard]]
+	inline bool empty() const override
+	{
+		return this->entries.empty();
+	}
+
+	// Returns the size of the container.
+	[[nodiscard]]
+	inline size_t size() const override
+	{
+		return this->entries.size();
+	}
+
+	// Compares two maps with the same types.
+	//
+	// Throws `TypeError` if `other` has different type.
+	[[nodiscard]]
+	inline short __cmp__(const Object* other) const override
+	{
+		if (auto other_v = dynamic_cast<const FlatMap<KeyT, ValueT>*>(other))
+		{
+			if (this->entries == other_v->entries)
+			{
+				return 0;
+			}
+
+			return this->entries > other_v->entries ? 1 : -1;
+		}
+
+		throw TypeError(
+			"'__cmp__' not supported between instances of '" + this->__type__().name() +
+			"' and '" + other->__type__().name() + "'",
+			_ERROR_DETAILS_
+		);
+	}
+
+	// Returns string representation of the container.
+	[[nodiscard]]
+	inline std::string __str__() const override
+	{
+		return this->aggregate();
+	}
+
+	// Returns string representation of the container using
+	// __repr__() method of container's values.
+	[[nodiscard]]
+	inline std::string __repr__() const override
+	{
+		return this->aggregate();
+	}
+};
+
+template <typename KeyT, typename ValueT>
+using flat_map = FlatMap<KeyT, ValueT>;
+
+__TYPES_END__
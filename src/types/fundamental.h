@@ -9,7 +9,7 @@
 #pragma once
 
 // STL libraries.
-// TODO
+#include <functional>
 
 // Module definitions.
 #include "./_def_.h"
@@ -202,8 +202,10 @@ public:
 
 	// Converts fundamental type to `std::string`. If internal type
 	// is `bool`, returns `true`/`false`. If type is floating-point
-	// (double, long double, float) trims unnecessary ending zeros.
-	// Otherwise returns string representation of `internal_value`.
+	// (double, long double, float) returns the shortest fixed notation
+	// which converts back to the same value, with at least one digit
+	// after the point. Otherwise returns `internal_value` formatted by
+	// `std::to_chars`.
 	[[nodiscard]]
 	inline std::string __str__() const override
 	{
@@ -211,23 +213,7 @@ public:
 		{
 			return this->internal_value ? "true" : "false";
 		}
-
-		if constexpr (
-			std::is_same_v<InternalT, double> ||
-			std::is_same_v<InternalT, long double> ||
-			std::is_same_v<InternalT, float>
-		)
-		{
-			std::string value = str::rtrim(std::to_string(this->internal_value), "0");
-			if (value.ends_with('.'))
-			{
-				value += "0";
-			}
-
-			return value;
-		}
-
-		if constexpr (
+		else if constexpr (
 			std::is_same_v<InternalT, signed char> ||
 			std::is_same_v<InternalT, unsigned char> ||
 			std::is_same_v<InternalT, char>
@@ -235,8 +221,10 @@ public:
 		{
 			return std::string(1, this->internal_value);
 		}
-
-		return std::to_string(this->internal_value);
+		else
+		{
+			return str::number_to_string(this->internal_value);
+		}
 	}
 
 	[[nodiscard]]
@@ -295,36 +283,36 @@ public:
 		return Fundamental<InternalT>(this->internal_value % right.internal_value);
 	}
 
+	// Values of the same type are compared directly, without
+	// `__cmp__`, which is used as keys of maps.
 	inline bool operator== (const Fundamental<InternalT>& other) const
 	{
-		return this->__cmp__(&other) == 0;
+		return this->internal_value == other.internal_value;
 	}
 
 	inline bool operator!= (const Fundamental<InternalT>& other) const
 	{
-		return this->__cmp__(&other) != 0;
+		return this->internal_value != other.internal_value;
 	}
 
 	inline bool operator< (const Fundamental<InternalT>& other) const
 	{
-		return this->__cmp__(&other) == -1;
+		return this->internal_value < other.internal_value;
 	}
 
 	inline bool operator<= (const Fundamental<InternalT>& other) const
 	{
-		auto ret_val = this->__cmp__(&other);
-		return ret_val == -1 || ret_val == 0;
+		return this->internal_value <= other.internal_value;
 	}
 
 	inline bool operator> (const Fundamental<InternalT>& other) const
 	{
-		return this->__cmp__(&other) == 1;
+		return this->internal_value > other.internal_value;
 	}
 
 	inline bool operator>= (const Fundamental<InternalT>& other) const
 	{
-		auto ret_val = this->__cmp__(&other);
-		return ret_val == 1 || ret_val == 0;
+		return this->internal_value >= other.internal_value;
 	}
 
 	inline bool operator! ()
@@ -567,3 +555,13 @@ using long_double = fundamental<long double>;
 using wchar_t_ = fundamental<wchar_t>;
 
 __TYPES_END__
+
+
+template <xw::types::fundamental_type T>
+struct std::hash<xw::types::Fundamental<T>>
+{
+	inline size_t operator()(const xw::types::Fundamental<T>& value) const noexcept
+	{
+		return std::hash<T>{}(value.get());
+	}
+};
@@ -0,0 +1,391 @@
+/**
+ * types/hash_map.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Hash map based on open addressing for rendering in templates.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./abstract.h"
+
+
+__TYPES_BEGIN__
+
+// Entries are stored in insertion order in a vector and indexed by a
+// hash table with linear probing, so lookups are a hash and usually one
+// key comparison, and iterating does not chase pointers.
+//
+// `HashT` must be a specialization of `std::hash` or have the same
+// interface; `types::String` and `types::Fundamental` provide one.
+// Erasing is O(n) because it preserves the order of entries.
+template <object_based_type KeyT, object_based_type ValueT, typename HashT = std::hash<KeyT>>
+class HashMap : public obj::Object, public MapContainer
+{
+public:
+	typedef KeyT key_type;
+	typedef ValueT value_type;
+	typedef std::pair<KeyT, ValueT> entry_type;
+	typedef typename std::vector<entry_type>::const_iterator const_iterator;
+	typedef typename std::vector<entry_type>::const_reverse_iterator const_reverse_iterator;
+
+protected:
+	static constexpr size_t npos = static_cast<size_t>(-1);
+	static constexpr size_t min_capacity = 8;
+
+	// Entries in insertion order and hashes of their keys.
+	std::vector<entry_type> entries;
+	std::vector<size_t> hashes;
+
+	// Index of the entry plus one, zero marks empty slot. The size is
+	// a power of two and at least twice the number of entries.
+	std::vector<uint32_t> slots;
+	int shift = 64;
+
+	// Fibonacci hashing spreads sequential and aligned hashes, which
+	// are common for integer keys, over the table.
+	[[nodiscard]]
+	inline size_t slot_of(size_t hash) const
+	{
+		return (size_t)(((uint64_t)hash * 0x9E3779B97F4A7C15ull) >> this->shift);
+	}
+
+	[[nodiscard]]
+	inline size_t find_index(const KeyT& key, size_t hash) const
+	{
+		if (this->slots.empty())
+		{
+			return npos;
+		}
+
+		auto mask = this->slots.size() - 1;
+		for (auto i = this->slot_of(hash); ; i = (i + 1) & mask)
+		{
+			auto slot = this->slots[i];
+			if (!slot)
+			{
+				return npos;
+			}
+
+			if (this->hashes[slot - 1] == hash && this->entries[slot - 1].first == key)
+			{
+				return slot - 1;
+			}
+		}
+	}
+
+	inline void place(size_t index)
+	{
+		auto mask = this->slots.size() - 1;
+		auto i = this->slot_of(this->hashes[index]);
+		while (this->slots[i])
+		{
+			i = (i + 1) & mask;
+		}
+
+		this->slots[i] = (uint32_t)(index + 1);
+	}
+
+	inline void rehash(size_t capacity)
+	{
+		this->slots.assign(capacity, 0);
+		this->shift = 64 - std::countr_zero((uint64_t)capacity);
+		for (size_t i = 0; i < this->entries.size(); i++)
+		{
+			this->place(i);
+		}
+	}
+
+	inline void append(KeyT&& key, ValueT&& value, size_t hash)
+	{
+		this->reserve(this->entries.size() + 1);
+		this->entries.emplace_back(std::move(key), std::move(value));
+		this->hashes.push_back(hash);
+		this->place(this->entries.size() - 1);
+	}
+
+	// Formats entries using __repr__() of keys and values.
+	[[nodiscard]]
+	inline std::string aggregate() const
+	{
+		std::string result = "{";
+		for (auto it = this->entries.begin(); it != this->entries.end(); it++)
+		{
+			if (it != this->entries.begin())
+			{
+				result += ", ";
+			}
+
+			result += "{" + it->first.__repr__() + ", " + it->second.__repr__() + "}";
+		}
+
+		return result + "}";
+	}
+
+	// Returns entries sorted by key for ordering maps as `Map` does.
+	[[nodiscard]]
+	inline std::vector<const entry_type*> sorted_entries() const
+	{
+		std::vector<const entry_type*> result;
+		result.reserve(this->entries.size());
+		for (const auto& entry : this->entries)
+		{
+			result.push_back(&entry);
+		}
+
+		std::sort(result.begin(), result.end(), [](const entry_type* left, const entry_type* right) -> bool {
+			return left->first < right->first;
+		});
+		return result;
+	}
+
+public:
+	// Default constructor.
+	inline explicit HashMap() = default;
+
+	// Constructs HashMap from initializer list. The first value of
+	// repeated key is kept.
+	inline HashMap(std::initializer_list<entry_type> list)
+	{
+		this->reserve(list.size());
+		for (const auto& entry : list)
+		{
+			this->insert(entry.first, entry.second);
+		}
+	}
+
+	// Prepares the table for `count` entries.
+	inline void reserve(size_t count)
+	{
+		if (count * 2 <= this->slots.size())
+		{
+			return;
+		}
+
+		auto capacity = std::max(this->slots.size(), min_capacity);
+		while (count * 2 > capacity)
+		{
+			capacity *= 2;
+		}
+
+		this->entries.reserve(count);
+		this->hashes.reserve(count);
+		this->rehash(capacity);
+	}
+
+	// Inserts the entry if `key` is not in the map.
+	//
+	// Returns `true` if the entry is inserted.
+	inline bool insert(KeyT key, ValueT value)
+	{
+		auto hash = HashT{}(key);
+		if (this->find_index(key, hash) != npos)
+		{
+			return false;
+		}
+
+		this->append(std::move(key), std::move(value), hash);
+		return true;
+	}
+
+	// Inserts the entry or replaces the value of existing `key`.
+	//
+	// Returns `true` if the entry is inserted.
+	inline bool insert_or_assign(KeyT key, ValueT value)
+	{
+		auto hash = HashT{}(key);
+		auto index = this->find_index(key, hash);
+		if (index != npos)
+		{
+			this->entries[index].second = std::move(value);
+			return false;
+		}
+
+		this->append(std::move(key), std::move(value), hash);
+		return true;
+	}
+
+	// Removes the entry of `key`.
+	//
+	// Returns `true` if the entry is removed.
+	inline bool erase(const KeyT& key)
+	{
+		auto index = this->find_index(key, HashT{}(key));
+		if (index == npos)
+		{
+			return false;
+		}
+
+		this->entries.erase(this->entries.begin() + (long)index);
+		this->hashes.erase(this->hashes.begin() + (long)index);
+		this->rehash(this->slots.size());
+		return true;
+	}
+
+	// Returns pointer to the value of `key` or `nullptr`.
+	[[nodiscard]]
+	inline const ValueT* find(const KeyT& key) const
+	{
+		auto index = this->find_index(key, HashT{}(key));
+		return index == npos ? nullptr : &this->entries[index].second;
+	}
+
+	[[nodiscard]]
+	inline bool contains(const KeyT& key) const
+	{
+		return this->find(key) != nullptr;
+	}
+
+	// Returns the value of `key`.
+	//
+	// Throws `KeyError` if `key` is not in the map.
+	[[nodiscard]]
+	inline const ValueT& at(const KeyT& key) const
+	{
+		if (auto value = this->find(key))
+		{
+			return *value;
+		}
+
+		throw KeyError(key.__repr__(), _ERROR_DETAILS_);
+	}
+
+	// Iterators over entries in insertion order.
+	[[nodiscard]]
+	inline const_iterator begin() const
+	{
+		return this->entries.begin();
+	}
+
+	[[nodiscard]]
+	inline const_iterator end() const
+	{
+		return this->entries.end();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rbegin() const
+	{
+		return this->entries.rbegin();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rend() const
+	{
+		return this->entries.rend();
+	}
+
+	// Iterates through entries in insertion order or in reversed
+	// order.
+	//
+	// `func`: function which handles key, value and index.
+	// `reversed`: iteration direction option.
+	inline void look_through(
+		const std::function<void(size_t, const obj::Object*, const obj::Object*)>& func, bool reversed
+	) const override
+	{
+		size_t i = 0;
+		if (reversed)
+		{
+			for (auto it = this->entries.rbegin(); it != this->entries.rend(); it++)
+			{
+				func(i++, &it->first, &it->second);
+			}
+		}
+		else
+		{
+			for (const auto& entry : this->entries)
+			{
+				func(i++, &entry.first, &entry.second);
+			}
+		}
+	}
+
+	// Returns `true` if container is empty, `false` otherwise.
+	[[nodiscard]]
+	inline bool empty() const override
+	{
+		return this->entries.empty();
+	}
+
+	// Returns the size of the container.
+	[[nodiscard]]
+	inline size_t size() const override
+	{
+		return this->entries.size();
+	}
+
+	// Compares two maps with the same types regardless of insertion
+	// order. Different maps are ordered as `Map` with the same entries.
+	//
+	// Throws `TypeError` if `other` has different type.
+	[[nodiscard]]
+	inline short __cmp__(const Object* other) const override
+	{
+		auto other_v = dynamic_cast<const HashMap<KeyT, ValueT, HashT>*>(other);
+		if (!other_v)
+		{
+			throw TypeError(
+				"'__cmp__' not supported between instances of '" + this->__type__().name() +
+				"' and '" + other->__type__().name() + "'",
+				_ERROR_DETAILS_
+			);
+		}
+
+		if (this->size() == other_v->size())
+		{
+			bool equal = true;
+			for (size_t i = 0; i < this->entries.size() && equal; i++)
+			{
+				auto index = other_v->find_index(this->entries[i].first, this->hashes[i]);
+				equal = index != npos && other_v->entries[index].second == this->entries[i].second;
+			}
+
+			if (equal)
+			{
+				return 0;
+			}
+		}
+
+		auto left = this->sorted_entries();
+		auto right = other_v->sorted_entries();
+		bool less = std::lexicographical_compare(
+			left.begin(), left.end(), right.begin(), right.end(),
+			[](const entry_type* l, const entry_type* r) -> bool { return *l < *r; }
+		);
+		return less ? -1 : 1;
+	}
+
+	// Returns string representation of the container.
+	[[nodiscard]]
+	inline std::string __str__() const override
+	{
+		return this->aggregate();
+	}
+
+	// Returns string representation of the container using
+	// __repr__() method of container's values.
+	[[nodiscard]]
+	inline std::string __repr__() const override
+	{
+		return this->aggregate();
+	}
+};
+
+template <typename KeyT, typename ValueT, typename HashT = std::hash<KeyT>>
+using hash_map = HashMap<KeyT, ValueT, HashT>;
+
+__TYPES_END__
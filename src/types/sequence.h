@@ -3,14 +3,14 @@
  *
  * Copyright (c) 2021 Yuriy Lisovskiy
  *
- * Wrapper for sequential containers based on `std::list`
- * for rendering in templates.
+ * Wrapper for sequential containers for rendering in templates.
  */
 
 #pragma once
 
 // C++ libraries.
-#include <list>
+#include <iterator>
+#include <vector>
 
 // Module definitions.
 #include "./_def_.h"
@@ -21,12 +21,19 @@
 
 __TYPES_BEGIN__
 
-template <object_based_type ValueT>
+// `ContainerT` is any sequential container of `ValueT`, for example
+// `std::vector`, `std::deque` or `std::list`. Default `std::vector`
+// suits read-mostly data best: values are stored contiguously and are
+// available through `objects()`.
+template <object_based_type ValueT, typename ContainerT = std::vector<ValueT>>
+requires std::is_same_v<typename ContainerT::value_type, ValueT>
 class Sequence : public obj::Object, public SequenceContainer
 {
 public:
 	typedef ValueT value_type;
-	typedef std::list<value_type> container_type;
+	typedef ContainerT container_type;
+	typedef typename container_type::const_iterator const_iterator;
+	typedef typename container_type::const_reverse_iterator const_reverse_iterator;
 
 protected:
 	container_type container;
@@ -111,6 +118,68 @@ public:
 		}
 	}
 
+	// Returns values as `ObjectSpan` if the container is contiguous.
+	[[nodiscard]]
+	inline std::optional<ObjectSpan> objects() const override
+	{
+		if constexpr (std::contiguous_iterator<const_iterator>)
+		{
+			return ObjectSpan::of(std::data(this->container), this->container.size());
+		}
+		else
+		{
+			return std::nullopt;
+		}
+	}
+
+	// Iterators of the container for typed traversal without
+	// `std::function` calls.
+	[[nodiscard]]
+	inline const_iterator begin() const
+	{
+		return this->container.begin();
+	}
+
+	[[nodiscard]]
+	inline const_iterator end() const
+	{
+		return this->container.end();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rbegin() const
+	{
+		return this->container.rbegin();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rend() const
+	{
+		return this->container.rend();
+	}
+
+	// Calls `func(index, value)` for each value in given direction.
+	// Unlike `look_through`, `func` can be inlined.
+	template <typename FuncT>
+	inline void for_each(FuncT&& func, bool reversed=false) const
+	{
+		size_t i = 0;
+		if (reversed)
+		{
+			for (auto it = this->container.rbegin(); it != this->container.rend(); it++)
+			{
+				func(i++, *it);
+			}
+		}
+		else
+		{
+			for (const auto& value : this->container)
+			{
+				func(i++, value);
+			}
+		}
+	}
+
 	// Returns `true` if container is empty, `false` otherwise.
 	[[nodiscard]]
 	bool empty() const override
@@ -138,7 +207,7 @@ public:
 	[[nodiscard]]
 	inline short __cmp__(const Object* other) const override
 	{
-		if (auto other_v = dynamic_cast<const Sequence<value_type>*>(other))
+		if (auto other_v = dynamic_cast<const Sequence<value_type, container_type>*>(other))
 		{
 			if (this->container == other_v->container)
 			{
@@ -175,7 +244,7 @@ public:
 	}
 };
 
-template <typename T>
-using sequence = Sequence<T>;
+template <typename T, typename ContainerT = std::vector<T>>
+using sequence = Sequence<T, ContainerT>;
 
 __TYPES_END__
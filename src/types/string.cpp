@@ -6,6 +6,9 @@
 
 #include "./string.h"
 
+// Base libraries.
+#include "./atom.h"
+
 
 __TYPES_BEGIN__
 
@@ -13,12 +16,13 @@ short String::__cmp__(const Object* other) const
 {
 	if (auto other_v = dynamic_cast<const String*>(other))
 	{
-		if (this->value < other_v->value)
-		{
-			return -1;
-		}
+		auto result = this->value.compare(other_v->value);
+		return result < 0 ? -1 : (result > 0 ? 1 : 0);
+	}
 
-		return this->value == other_v->value ? 0 : 1;
+	if (auto other_v = dynamic_cast<const Atom*>(other))
+	{
+		return (short)-other_v->__cmp__(this);
 	}
 
 	throw TypeError(
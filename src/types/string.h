@@ -8,6 +8,11 @@
 
 #pragma once
 
+// C++ libraries.
+#include <functional>
+#include <string>
+#include <string_view>
+
 // Module definitions.
 #include "./_def_.h"
 
@@ -37,6 +42,13 @@ public:
 	{
 	}
 
+	// Constructs String from `std::string_view`. Strings that repeat
+	// many times or reference static storage are better stored as
+	// `Atom`.
+	inline explicit String(std::string_view s) : value(s)
+	{
+	}
+
 	// Returns an internal string value.
 	[[nodiscard]]
 	inline std::string __str__() const override
@@ -48,12 +60,17 @@ public:
 	[[nodiscard]]
 	inline std::string __repr__() const override
 	{
-		return "\"" + this->value + "\"";
+		std::string result;
+		result.reserve(this->value.size() + 2);
+		result += '"';
+		result += this->value;
+		result += '"';
+		return result;
 	}
 
 	// Compares two objects.
 	//
-	// Throws `TypeError` if `other` is not `String`-type object.
+	// Throws `TypeError` if `other` is not `String` or `Atom`.
 	[[nodiscard]]
 	short __cmp__(const Object* other) const override;
 
@@ -69,6 +86,13 @@ public:
 		return this->value.empty();
 	}
 
+	// Returns an internal string value.
+	[[nodiscard]]
+	inline const std::string& get() const
+	{
+		return this->value;
+	}
+
 	// Returns an address to internal string.
 	inline std::string& operator* ()
 	{
@@ -115,3 +139,13 @@ public:
 using string = String;
 
 __TYPES_END__
+
+
+template <>
+struct std::hash<xw::types::String>
+{
+	inline size_t operator()(const xw::types::String& s) const noexcept
+	{
+		return std::hash<std::string>{}(s.get());
+	}
+};
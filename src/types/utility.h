@@ -23,6 +23,11 @@
 #include "./datetime.h"
 #include "./sequence.h"
 #include "./map.h"
+#include "./hash_map.h"
+#include "./flat_map.h"
+#include "./view.h"
+#include "./arena.h"
+#include "./atom.h"
 
 
 __TYPES_BEGIN__
@@ -33,39 +38,38 @@ Sequence<iterator_v_type<IteratorT>> to_sequence(IteratorT begin, IteratorT end)
 {
 	using T = iterator_v_type<IteratorT>;
 	Sequence<T> result;
-	*result = std::list<T>(begin, end);
+	*result = typename Sequence<T>::container_type(begin, end);
 	return result;
 }
 
-// Converts fundamentals, 'std::string', 'const char*', 'xw::dt::Date',
-// 'xw::dt::Time', 'xw::dt::Datetime' or 'xw::obj::Object'-based instances
-// to 'std::shared_ptr<const xw::obj::Object>'.
-template <typename T>
-std::shared_ptr<const obj::Object> to_object(const T& value)
+// Makes 'xw::types' value of `value` using `allocator`, which is
+// 'xw::types::HeapAllocator' or 'xw::types::Arena'.
+template <typename T, typename AllocatorT>
+std::shared_ptr<const obj::Object> _to_object(const T& value, AllocatorT& allocator)
 {
 	if constexpr (std::is_fundamental_v<T>)
 	{
-		return std::make_shared<Fundamental<T>>(value);
+		return allocator.template make<Fundamental<T>>(value);
 	}
 	else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, const char*>)
 	{
-		return std::make_shared<types::String>(value);
+		return allocator.template make<types::String>(value);
 	}
 	else if constexpr (std::is_same_v<T, dt::Date>)
 	{
-		return std::make_shared<Date>(value);
+		return allocator.template make<Date>(value);
 	}
 	else if constexpr (std::is_same_v<T, dt::Time>)
 	{
-		return std::make_shared<Time>(value);
+		return allocator.template make<Time>(value);
 	}
 	else if constexpr (std::is_same_v<T, dt::Datetime>)
 	{
-		return std::make_shared<Datetime>(value);
+		return allocator.template make<Datetime>(value);
 	}
 	else if constexpr (std::is_base_of_v<obj::Object, T>)
 	{
-		return std::make_shared<T>(value);
+		return allocator.template make<T>(value);
 	}
 
 	throw TypeError(
@@ -74,6 +78,23 @@ std::shared_ptr<const obj::Object> to_object(const T& value)
 	);
 }
 
+// Converts fundamentals, 'std::string', 'const char*', 'xw::dt::Date',
+// 'xw::dt::Time', 'xw::dt::Datetime' or 'xw::obj::Object'-based instances
+// to 'std::shared_ptr<const xw::obj::Object>'.
+template <typename T>
+std::shared_ptr<const obj::Object> to_object(const T& value)
+{
+	HeapAllocator allocator;
+	return _to_object(value, allocator);
+}
+
+// Same as above, but allocates the result in `arena`.
+template <typename T>
+std::shared_ptr<const obj::Object> to_object(const T& value, Arena& arena)
+{
+	return _to_object(value, arena);
+}
+
 // Converts 'std::array' to 'std::shared_ptr<const xw::obj::Object>'
 template <object_based_type T, std::size_t Nm>
 std::shared_ptr<const obj::Object> to_object(const std::array<T, Nm>& v)
@@ -88,6 +109,14 @@ std::shared_ptr<const obj::Object> to_object(const std::vector<T>& v)
 	return std::make_shared<Sequence<T>>(to_sequence(v.begin(), v.end()));
 }
 
+// Moves 'std::vector' to 'std::shared_ptr<const xw::obj::Object>'
+// without copying values.
+template <object_based_type T>
+std::shared_ptr<const obj::Object> to_object(std::vector<T>&& v)
+{
+	return std::make_shared<Sequence<T>>(std::move(v));
+}
+
 // Converts 'std::deque' to 'std::shared_ptr<const xw::obj::Object>'
 template <object_based_type T>
 std::shared_ptr<const obj::Object> to_object(const std::deque<T>& v)
@@ -110,10 +139,10 @@ std::shared_ptr<const obj::Object> to_object(const std::list<T>& v)
 }
 
 // Converts 'xw::types::Sequence' to 'std::shared_ptr<const xw::obj::Object>'
-template <object_based_type T>
-std::shared_ptr<const obj::Object> to_object(const Sequence<T>& v)
+template <object_based_type T, typename ContainerT>
+std::shared_ptr<const obj::Object> to_object(const Sequence<T, ContainerT>& v)
 {
-	return std::make_shared<Sequence<T>>(v);
+	return std::make_shared<Sequence<T, ContainerT>>(v);
 }
 
 // Converts 'std::map' to 'std::shared_ptr<const xw::obj::Object>'
@@ -123,6 +152,14 @@ std::shared_ptr<const obj::Object> to_object(const std::map<KeyT, ValT>& v)
 	return std::make_shared<Map<KeyT, ValT>>(v);
 }
 
+// Moves 'std::map' to 'std::shared_ptr<const xw::obj::Object>'
+// without copying entries.
+template <object_based_type KeyT, object_based_type ValT>
+std::shared_ptr<const obj::Object> to_object(std::map<KeyT, ValT>&& v)
+{
+	return std::make_shared<Map<KeyT, ValT>>(std::move(v));
+}
+
 // Converts 'xw::types::Map' to 'std::shared_ptr<const xw::obj::Object>'
 template <object_based_type KeyT, object_based_type ValT>
 std::shared_ptr<const obj::Object> to_object(const Map<KeyT, ValT>& v)
@@ -130,4 +167,51 @@ std::shared_ptr<const obj::Object> to_object(const Map<KeyT, ValT>& v)
 	return std::make_shared<Map<KeyT, ValT>>(v);
 }
 
+// Converts 'xw::types::HashMap' to 'std::shared_ptr<const xw::obj::Object>'
+template <object_based_type KeyT, object_based_type ValT, typename HashT>
+std::shared_ptr<const obj::Object> to_object(const HashMap<KeyT, ValT, HashT>& v)
+{
+	return std::make_shared<HashMap<KeyT, ValT, HashT>>(v);
+}
+
+// Converts 'xw::types::FlatMap' to 'std::shared_ptr<const xw::obj::Object>'
+template <object_based_type KeyT, object_based_type ValT>
+std::shared_ptr<const obj::Object> to_object(const FlatMap<KeyT, ValT>& v)
+{
+	return std::make_shared<FlatMap<KeyT, ValT>>(v);
+}
+
+// Makes 'xw::types::MapView' of containers with 'mapped_type', for
+// example 'std::map', or 'xw::types::SequenceView' of other containers.
+template <typename ContainerT>
+std::shared_ptr<const obj::Object> _make_view(std::shared_ptr<const ContainerT> v)
+{
+	if constexpr (requires { typename ContainerT::mapped_type; })
+	{
+		return std::make_shared<MapView<ContainerT>>(std::move(v));
+	}
+	else
+	{
+		return std::make_shared<SequenceView<ContainerT>>(std::move(v));
+	}
+}
+
+// Converts sequential or map container to 'std::shared_ptr<const xw::obj::Object>'
+// which refers to `v` without copying it. `v` must outlive the result.
+template <typename ContainerT>
+std::shared_ptr<const obj::Object> to_object_view(const ContainerT& v)
+{
+	return _make_view(_borrow(v));
+}
+
+// Converts shared sequential or map container to 'std::shared_ptr<const xw::obj::Object>'
+// which shares ownership of `v` without copying it.
+//
+// Throws `NullPointerException` if `v` is `nullptr`.
+template <typename ContainerT>
+std::shared_ptr<const obj::Object> to_object(const std::shared_ptr<ContainerT>& v)
+{
+	return _make_view(std::shared_ptr<const std::remove_const_t<ContainerT>>(v));
+}
+
 __TYPES_END__
@@ -0,0 +1,421 @@
+/**
+ * types/value.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include "./value.h"
+
+// Base libraries.
+#include "../string_utils.h"
+#include "./fundamental.h"
+#include "./string.h"
+#include "./atom.h"
+#include "./datetime.h"
+#include "./sequence.h"
+#include "./map.h"
+
+
+__TYPES_BEGIN__
+
+template <typename T>
+concept _number_alternative = std::is_same_v<T, bool> ||
+	std::is_same_v<T, int64_t> ||
+	std::is_same_v<T, double>;
+
+template <typename T>
+static inline short _cmp(const T& left, const T& right)
+{
+	if (left < right)
+	{
+		return -1;
+	}
+
+	return left == right ? 0 : 1;
+}
+
+// Converts fundamentals of types `T` and `RestT` by constructors of
+// `Value`.
+template <typename T, typename ...RestT>
+static bool _from_fundamental(const obj::Object* object, Value& result)
+{
+	if (auto fundamental = dynamic_cast<const Fundamental<T>*>(object))
+	{
+		result = Value(fundamental->get());
+		return true;
+	}
+
+	if constexpr (sizeof...(RestT) > 0)
+	{
+		return _from_fundamental<RestT...>(object, result);
+	}
+	else
+	{
+		return false;
+	}
+}
+
+Value::Value(std::shared_ptr<const sequence_type> v)
+{
+	if (!v)
+	{
+		throw NullPointerException("sequence is nullptr", _ERROR_DETAILS_);
+	}
+
+	this->value = std::move(v);
+}
+
+Value::Value(std::shared_ptr<const map_type> v)
+{
+	if (!v)
+	{
+		throw NullPointerException("map is nullptr", _ERROR_DETAILS_);
+	}
+
+	this->value = std::move(v);
+}
+
+Value Value::from_object(const obj::Object* object)
+{
+	if (!object)
+	{
+		return {};
+	}
+
+	if (auto value_object = dynamic_cast<const ValueObject*>(object))
+	{
+		return value_object->get();
+	}
+
+	if (auto string = dynamic_cast<const String*>(object))
+	{
+		return string->get();
+	}
+
+	if (auto atom = dynamic_cast<const Atom*>(object))
+	{
+		return Value(atom->view());
+	}
+
+	Value result;
+	if (_from_fundamental<
+		bool, int, long int, long long int, unsigned int, unsigned long int, unsigned long long int,
+		short int, unsigned short int, char, signed char, unsigned char, wchar_t, char8_t, char16_t, char32_t,
+		double, float, long double
+	>(object, result))
+	{
+		return result;
+	}
+
+	if (auto datetime = dynamic_cast<const Datetime*>(object))
+	{
+		return datetime->get();
+	}
+
+	if (auto sequence = dynamic_cast<const SequenceContainer*>(object))
+	{
+		sequence_type values;
+		values.reserve(sequence->size());
+		if (auto objects = sequence->objects())
+		{
+			for (const auto& item : *objects)
+			{
+				values.push_back(Value::from_object(&item));
+			}
+		}
+		else
+		{
+			sequence->look_through([&values](size_t, const obj::Object* item)
+			{
+				values.push_back(Value::from_object(item));
+			}, false);
+		}
+
+		return values;
+	}
+
+	if (auto map = dynamic_cast<const MapContainer*>(object))
+	{
+		map_type values;
+		map->look_through([&values](size_t, const obj::Object* key, const obj::Object* item)
+		{
+			values.emplace(key ? key->__str__() : "", Value::from_object(item));
+		}, false);
+		return values;
+	}
+
+	return object->__str__();
+}
+
+std::shared_ptr<const obj::Object> Value::to_object() const
+{
+	return this->visit([this](const auto& v) -> std::shared_ptr<const obj::Object>
+	{
+		using T = std::decay_t<decltype(v)>;
+		if constexpr (_number_alternative<T>)
+		{
+			return std::make_shared<Fundamental<T>>(v);
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return std::make_shared<String>(v);
+		}
+		else if constexpr (std::is_same_v<T, dt::CompactDatetime>)
+		{
+			return std::make_shared<Datetime>(v.to_datetime());
+		}
+		else if constexpr (std::is_same_v<T, std::shared_ptr<const sequence_type>>)
+		{
+			std::vector<ValueObject> items(v->begin(), v->end());
+			return std::make_shared<Sequence<ValueObject>>(std::move(items));
+		}
+		else if constexpr (std::is_same_v<T, std::shared_ptr<const map_type>>)
+		{
+			std::map<String, ValueObject> items;
+			for (const auto& [key, item] : *v)
+			{
+				items.emplace_hint(items.end(), key, ValueObject(item));
+			}
+
+			return std::make_shared<Map<String, ValueObject>>(std::move(items));
+		}
+		else
+		{
+			return std::make_shared<ValueObject>(*this);
+		}
+	});
+}
+
+std::string_view Value::kind_name() const
+{
+	static const std::string_view names[] = {
+		"null", "bool", "int", "double", "string", "datetime", "sequence", "map"
+	};
+	return names[this->value.index()];
+}
+
+std::string Value::str() const
+{
+	return this->visit([this](const auto& v) -> std::string
+	{
+		using T = std::decay_t<decltype(v)>;
+		if constexpr (std::is_same_v<T, std::nullptr_t>)
+		{
+			return "null";
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			return v ? "true" : "false";
+		}
+		else if constexpr (std::is_same_v<T, int64_t> || std::is_same_v<T, double>)
+		{
+			return str::number_to_string(v);
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return v;
+		}
+		else if constexpr (std::is_same_v<T, dt::CompactDatetime>)
+		{
+			return v.iso_format(' ');
+		}
+		else
+		{
+			return this->repr();
+		}
+	});
+}
+
+std::string Value::repr() const
+{
+	return this->visit([this](const auto& v) -> std::string
+	{
+		using T = std::decay_t<decltype(v)>;
+		if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, dt::CompactDatetime>)
+		{
+			auto s = this->str();
+			std::string result;
+			result.reserve(s.size() + 2);
+			result += '"';
+			result += s;
+			result += '"';
+			return result;
+		}
+		else if constexpr (std::is_same_v<T, std::shared_ptr<const sequence_type>>)
+		{
+			std::string result = "{";
+			for (auto it = v->begin(); it != v->end(); it++)
+			{
+				if (it != v->begin())
+				{
+					result += ", ";
+				}
+
+				result += it->repr();
+			}
+
+			return result + "}";
+		}
+		else if constexpr (std::is_same_v<T, std::shared_ptr<const map_type>>)
+		{
+			std::string result = "{";
+			for (auto it = v->begin(); it != v->end(); it++)
+			{
+				if (it != v->begin())
+				{
+					result += ", ";
+				}
+
+				result += "{\"" + it->first + "\", " + it->second.repr() + "}";
+			}
+
+			return result + "}";
+		}
+		else
+		{
+			return this->str();
+		}
+	});
+}
+
+short Value::compare(const Value& other) const
+{
+	return std::visit([this, &other](const auto& left, const auto& right) -> short
+	{
+		using L = std::decay_t<decltype(left)>;
+		using R = std::decay_t<decltype(right)>;
+		if constexpr (_number_alternative<L> && _number_alternative<R>)
+		{
+			if constexpr (std::is_same_v<L, double> || std::is_same_v<R, double>)
+			{
+				return _cmp((double)left, (double)right);
+			}
+			else
+			{
+				return _cmp((int64_t)left, (int64_t)right);
+			}
+		}
+		else if constexpr (!std::is_same_v<L, R>)
+		{
+			throw TypeError(
+				"comparison is not supported between values of kinds '" + std::string(this->kind_name()) +
+				"' and '" + std::string(other.kind_name()) + "'",
+				_ERROR_DETAILS_
+			);
+		}
+		else if constexpr (std::is_same_v<L, std::nullptr_t>)
+		{
+			return 0;
+		}
+		else if constexpr (std::is_same_v<L, std::shared_ptr<const sequence_type>>)
+		{
+			for (size_t i = 0; i < left->size() && i < right->size(); i++)
+			{
+				if (auto result = (*left)[i].compare((*right)[i]))
+				{
+					return result;
+				}
+			}
+
+			return _cmp(left->size(), right->size());
+		}
+		else if constexpr (std::is_same_v<L, std::shared_ptr<const map_type>>)
+		{
+			auto l = left->begin();
+			auto r = right->begin();
+			for (; l != left->end() && r != right->end(); l++, r++)
+			{
+				if (auto result = _cmp(l->first, r->first))
+				{
+					return result;
+				}
+
+				if (auto result = l->second.compare(r->second))
+				{
+					return result;
+				}
+			}
+
+			return _cmp(left->size(), right->size());
+		}
+		else
+		{
+			return _cmp(left, right);
+		}
+	}, this->value, other.value);
+}
+
+Value::operator bool () const
+{
+	return this->visit([](const auto& v) -> bool
+	{
+		using T = std::decay_t<decltype(v)>;
+		if constexpr (std::is_same_v<T, std::nullptr_t>)
+		{
+			return false;
+		}
+		else if constexpr (_number_alternative<T>)
+		{
+			return v != 0;
+		}
+		else if constexpr (std::is_same_v<T, dt::CompactDatetime>)
+		{
+			return true;
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return !v.empty();
+		}
+		else
+		{
+			return !v->empty();
+		}
+	});
+}
+
+bool Value::operator== (const Value& other) const
+{
+	return std::visit([](const auto& left, const auto& right) -> bool
+	{
+		using L = std::decay_t<decltype(left)>;
+		using R = std::decay_t<decltype(right)>;
+		if constexpr (_number_alternative<L> && _number_alternative<R>)
+		{
+			if constexpr (std::is_same_v<L, double> || std::is_same_v<R, double>)
+			{
+				return (double)left == (double)right;
+			}
+			else
+			{
+				return (int64_t)left == (int64_t)right;
+			}
+		}
+		else if constexpr (!std::is_same_v<L, R>)
+		{
+			return false;
+		}
+		else if constexpr (
+			std::is_same_v<L, std::shared_ptr<const sequence_type>> ||
+			std::is_same_v<L, std::shared_ptr<const map_type>>
+		)
+		{
+			return left == right || *left == *right;
+		}
+		else
+		{
+			return left == right;
+		}
+	}, this->value, other.value);
+}
+
+short ValueObject::__cmp__(const Object* other) const
+{
+	if (auto other_v = dynamic_cast<const ValueObject*>(other))
+	{
+		return this->value.compare(other_v->value);
+	}
+
+	return this->value.compare(Value::from_object(other));
+}
+
+__TYPES_END__
@@ -0,0 +1,354 @@
+/**
+ * types/value.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Closed set of template values dispatched without virtual calls.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "../datetime_compact.h"
+#include "../object/object.h"
+
+
+__TYPES_BEGIN__
+
+template <typename T>
+concept _narrow_char = std::is_same_v<T, char> ||
+	std::is_same_v<T, signed char> ||
+	std::is_same_v<T, unsigned char>;
+
+// Value of one of the fixed set of types: null, bool, integer, double,
+// string, date and time, sequence and map. Operations use `std::visit`
+// over `std::variant`, which compiles to a jump table, instead of
+// virtual calls and `dynamic_cast` of `obj::Object`.
+//
+// Sequences and maps are immutable and shared between copies, so values
+// are cheap to copy. Date and time is stored as `dt::CompactDatetime`,
+// which keeps UTC offset but not the time zone.
+class Value final
+{
+public:
+	typedef std::vector<Value> sequence_type;
+	typedef std::map<std::string, Value, std::less<>> map_type;
+
+	typedef std::variant<
+		std::nullptr_t,
+		bool,
+		int64_t,
+		double,
+		std::string,
+		dt::CompactDatetime,
+		std::shared_ptr<const sequence_type>,
+		std::shared_ptr<const map_type>
+	> variant_type;
+
+	// Order of alternatives of `variant_type`.
+	enum class Kind
+	{
+		Null, Bool, Int, Double, String, Datetime, Sequence, Map
+	};
+
+protected:
+	variant_type value;
+
+public:
+
+	// Makes null.
+	inline Value() : value(nullptr)
+	{
+	}
+
+	inline Value(std::nullptr_t) : value(nullptr)
+	{
+	}
+
+	inline Value(bool v) : value(v)
+	{
+	}
+
+	// Makes one-character string, the same as `Fundamental::__str__()`
+	// formats narrow characters.
+	template <_narrow_char T>
+	inline Value(T v) : value(std::string(1, (char)v))
+	{
+	}
+
+	// Other integers, including wide characters, are numbers. Unsigned
+	// integers greater than `INT64_MAX` are stored as double, so they
+	// keep the sign and the magnitude but may lose precision.
+	template <std::integral T>
+	requires (!std::is_same_v<T, bool> && !_narrow_char<T>)
+	inline Value(T v) : value((int64_t)v)
+	{
+		if constexpr (std::is_unsigned_v<T> && sizeof(T) >= sizeof(int64_t))
+		{
+			if (v > (T)std::numeric_limits<int64_t>::max())
+			{
+				this->value = (double)v;
+			}
+		}
+	}
+
+	template <std::floating_point T>
+	inline Value(T v) : value((double)v)
+	{
+	}
+
+	inline Value(std::string v) : value(std::move(v))
+	{
+	}
+
+	inline Value(const char* v) : value(std::string(v))
+	{
+	}
+
+	inline explicit Value(std::string_view v) : value(std::string(v))
+	{
+	}
+
+	inline Value(dt::CompactDatetime v) : value(v)
+	{
+	}
+
+	inline Value(const dt::Datetime& v) : value(dt::CompactDatetime::from_datetime(v))
+	{
+	}
+
+	inline Value(sequence_type v) : value(std::make_shared<const sequence_type>(std::move(v)))
+	{
+	}
+
+	inline Value(map_type v) : value(std::make_shared<const map_type>(std::move(v)))
+	{
+	}
+
+	// Shares `v`.
+	//
+	// Throws `NullPointerException` if `v` is `nullptr`.
+	Value(std::shared_ptr<const sequence_type> v);
+
+	// Shares `v`.
+	//
+	// Throws `NullPointerException` if `v` is `nullptr`.
+	Value(std::shared_ptr<const map_type> v);
+
+	// Converts `xw::types` objects: `nullptr` to null, `Fundamental`
+	// the same way as constructors from its value do, so narrow
+	// characters become strings and wide characters become integers,
+	// `String` and `Atom` to string, `Datetime` to date and time,
+	// sequence and map containers recursively, keys of maps by their
+	// `__str__()`. Other objects are converted to strings using
+	// `__str__()`.
+	static Value from_object(const obj::Object* object);
+
+	// Converts to `xw::types` objects: null to `ValueObject`, bool,
+	// integer and double to `Fundamental`, string to `String`, date and
+	// time to `Datetime`, sequence to `Sequence<ValueObject>` and map to
+	// `Map<String, ValueObject>`.
+	[[nodiscard]]
+	std::shared_ptr<const obj::Object> to_object() const;
+
+	[[nodiscard]]
+	inline Kind kind() const
+	{
+		return (Kind)this->value.index();
+	}
+
+	// Returns name of the kind for error messages.
+	[[nodiscard]]
+	std::string_view kind_name() const;
+
+	[[nodiscard]]
+	inline const variant_type& get() const
+	{
+		return this->value;
+	}
+
+	[[nodiscard]]
+	inline bool is_null() const
+	{
+		return this->kind() == Kind::Null;
+	}
+
+	// Checks if alternative `T` of `variant_type` is held.
+	template <typename T>
+	[[nodiscard]]
+	inline bool is() const
+	{
+		return std::holds_alternative<T>(this->value);
+	}
+
+	// Returns alternative `T` of `variant_type`.
+	//
+	// Throws `TypeError` if other alternative is held.
+	template <typename T>
+	[[nodiscard]]
+	inline const T& as() const
+	{
+		if (auto result = std::get_if<T>(&this->value))
+		{
+			return *result;
+		}
+
+		throw TypeError(
+			"value of kind '" + std::string(this->kind_name()) + "' does not hold '" +
+			demangle(typeid(T).name()) + "'",
+			_ERROR_DETAILS_
+		);
+	}
+
+	// Calls `visitor` with the held alternative.
+	template <typename VisitorT>
+	inline decltype(auto) visit(VisitorT&& visitor) const
+	{
+		return std::visit(std::forward<VisitorT>(visitor), this->value);
+	}
+
+	// Returns string representation, the same as `__str__()` of the
+	// object returned by `to_object()`.
+	[[nodiscard]]
+	std::string str() const;
+
+	// Returns string representation, the same as `__repr__()` of the
+	// object returned by `to_object()`.
+	[[nodiscard]]
+	std::string repr() const;
+
+	// Compares two values. Numbers and bools are compared by value,
+	// sequences and maps lexicographically, nulls are equal.
+	//
+	// Throws `TypeError` if kinds of values cannot be compared.
+	[[nodiscard]]
+	short compare(const Value& other) const;
+
+	// Returns `false` for null, `false`, zero and empty string,
+	// sequence or map, `true` otherwise.
+	explicit operator bool () const;
+
+	// Returns `false` if values cannot be compared instead of throwing.
+	bool operator== (const Value& other) const;
+
+	inline bool operator!= (const Value& other) const
+	{
+		return !(*this == other);
+	}
+
+	inline bool operator< (const Value& other) const
+	{
+		return this->compare(other) < 0;
+	}
+
+	inline bool operator<= (const Value& other) const
+	{
+		return this->compare(other) <= 0;
+	}
+
+	inline bool operator> (const Value& other) const
+	{
+		return this->compare(other) > 0;
+	}
+
+	inline bool operator>= (const Value& other) const
+	{
+		return this->compare(other) >= 0;
+	}
+};
+
+// `obj::Object` which holds `Value`, used where objects are required,
+// for example for nulls and items of converted sequences and maps.
+class ValueObject final : public obj::Object
+{
+protected:
+	Value value;
+
+public:
+	ValueObject() = default;
+
+	inline explicit ValueObject(Value v) : value(std::move(v))
+	{
+	}
+
+	[[nodiscard]]
+	inline const Value& get() const
+	{
+		return this->value;
+	}
+
+	[[nodiscard]]
+	inline std::string __str__() const override
+	{
+		return this->value.str();
+	}
+
+	[[nodiscard]]
+	inline std::string __repr__() const override
+	{
+		return this->value.repr();
+	}
+
+	// Compares values, converting `other` by `Value::from_object` if it
+	// is not `ValueObject`.
+	//
+	// Throws `TypeError` if values cannot be compared.
+	[[nodiscard]]
+	short __cmp__(const Object* other) const override;
+
+	inline explicit operator bool () const override
+	{
+		return (bool)this->value;
+	}
+
+	inline bool operator! () const override
+	{
+		return !(bool)this->value;
+	}
+
+	inline bool operator== (const ValueObject& other) const
+	{
+		return this->value == other.value;
+	}
+
+	inline bool operator!= (const ValueObject& other) const
+	{
+		return this->value != other.value;
+	}
+
+	inline bool operator< (const ValueObject& other) const
+	{
+		return this->value < other.value;
+	}
+
+	inline bool operator<= (const ValueObject& other) const
+	{
+		return this->value <= other.value;
+	}
+
+	inline bool operator> (const ValueObject& other) const
+	{
+		return this->value > other.value;
+	}
+
+	inline bool operator>= (const ValueObject& other) const
+	{
+		return this->value >= other.value;
+	}
+};
+
+__TYPES_END__
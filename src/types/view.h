@@ -0,0 +1,385 @@
+/**
+ * types/view.h
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ *
+ * Containers for rendering in templates which refer to existing data
+ * instead of copying it.
+ */
+
+#pragma once
+
+// C++ libraries.
+#include <iterator>
+#include <memory>
+
+// Module definitions.
+#include "./_def_.h"
+
+// Base libraries.
+#include "./abstract.h"
+
+
+__TYPES_BEGIN__
+
+// Makes pointer to `value` which does not own it. Views constructed
+// from references use it, so the same code handles borrowed and shared
+// data.
+template <typename T>
+inline std::shared_ptr<const T> _borrow(const T& value)
+{
+	return std::shared_ptr<const T>(std::shared_ptr<const T>(), &value);
+}
+
+// Sequential container of `obj::Object`-based values which is owned
+// elsewhere, for example `std::vector`, `std::deque` or `std::list`.
+//
+// The view is constructed either from a reference, then the container
+// must outlive it, or from `std::shared_ptr`, then the view shares
+// ownership. To refer to a member of a shared object, for example to
+// rows of a query result, construct `std::shared_ptr` with aliasing
+// constructor.
+template <typename ContainerT>
+requires object_based_type<typename ContainerT::value_type>
+class SequenceView : public obj::Object, public SequenceContainer
+{
+public:
+	typedef typename ContainerT::value_type value_type;
+	typedef ContainerT container_type;
+	typedef typename container_type::const_iterator const_iterator;
+	typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+
+protected:
+	std::shared_ptr<const container_type> container;
+
+	// Aggregates container values to string.
+	// Used for `__str__()` and `__repr__()` methods.
+	[[nodiscard]]
+	inline std::string aggregate() const
+	{
+		std::string res = "{";
+		for (auto it = this->container->begin(); it != this->container->end(); it++)
+		{
+			if (it != this->container->begin())
+			{
+				res += ", ";
+			}
+
+			res += it->__repr__();
+		}
+
+		return res + "}";
+	}
+
+public:
+
+	// Refers to `value` without owning it.
+	inline explicit SequenceView(const container_type& value) : container(_borrow(value))
+	{
+	}
+
+	// Shares ownership of `value`.
+	//
+	// Throws `NullPointerException` if `value` is `nullptr`.
+	inline explicit SequenceView(std::shared_ptr<const container_type> value) : container(std::move(value))
+	{
+		if (!this->container)
+		{
+			throw NullPointerException("container is nullptr", _ERROR_DETAILS_);
+		}
+	}
+
+	// Iterates through sequential container in given direction.
+	//
+	// `func`: function which handles an item and it's index.
+	// `reversed`: iteration direction option.
+	inline void look_through(
+		const std::function<void(size_t, const obj::Object*)>& func, bool reversed
+	) const override
+	{
+		size_t i = 0;
+		if (reversed)
+		{
+			for (auto it = this->container->rbegin(); it != this->container->rend(); it++)
+			{
+				func(i++, &(*it));
+			}
+		}
+		else
+		{
+			for (const auto& value : *this->container)
+			{
+				func(i++, &value);
+			}
+		}
+	}
+
+	// Returns values as `ObjectSpan` if the container is contiguous.
+	[[nodiscard]]
+	inline std::optional<ObjectSpan> objects() const override
+	{
+		if constexpr (std::contiguous_iterator<const_iterator>)
+		{
+			return ObjectSpan::of(std::data(*this->container), this->container->size());
+		}
+		else
+		{
+			return std::nullopt;
+		}
+	}
+
+	[[nodiscard]]
+	inline const_iterator begin() const
+	{
+		return this->container->begin();
+	}
+
+	[[nodiscard]]
+	inline const_iterator end() const
+	{
+		return this->container->end();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rbegin() const
+	{
+		return this->container->rbegin();
+	}
+
+	[[nodiscard]]
+	inline const_reverse_iterator rend() const
+	{
+		return this->container->rend();
+	}
+
+	// Returns `true` if container is empty, `false` otherwise.
+	[[nodiscard]]
+	inline bool empty() const override
+	{
+		return this->container->empty();
+	}
+
+	// Returns the size of the container.
+	[[nodiscard]]
+	inline size_t size() const override
+	{
+		return this->container->size();
+	}
+
+	// Returns the viewed container.
+	inline const container_type& operator* () const
+	{
+		return *this->container;
+	}
+
+	// Compares two views of the same container type.
+	//
+	// Throws `TypeError` if `other` has different type.
+	[[nodiscard]]
+	inline short __cmp__(const Object* other) const override
+	{
+		if (auto other_v = dynamic_cast<const SequenceView<container_type>*>(other))
+		{
+			if (*this->container == *other_v->container)
+			{
+				return 0;
+			}
+
+			return *this->container > *other_v->container ? 1 : -1;
+		}
+
+		throw TypeError(
+			"'__cmp__' not supported between instances of '" + this->__type__().name() +
+			"' and '" + other->__type__().name() + "'",
+			_ERROR_DETAILS_
+		);
+	}
+
+	// Returns string representation of the container.
+	[[nodiscard]]
+	inline std::string __str__() const override
+	{
+		return this->aggregate();
+	}
+
+	// Returns string representation of the container using
+	// __repr__() method of container's values.
+	[[nodiscard]]
+	inline std::string __repr__() const override
+	{
+		return this->aggregate();
+	}
+};
+
+// Map of `obj::Object`-based keys and values which is owned elsewhere,
+// for example `std::map` or `std::unordered_map`. Ownership options are
+// the same as of `SequenceView`.
+template <typename ContainerT>
+requires object_based_type<typename ContainerT::key_type> &&
+	object_based_type<typename ContainerT::mapped_type>
+class MapView : public obj::Object, public MapContainer
+{
+public:
+	typedef typename ContainerT::key_type key_type;
+	typedef typename ContainerT::mapped_type value_type;
+	typedef ContainerT container_type;
+	typedef typename container_type::const_iterator const_iterator;
+
+protected:
+	std::shared_ptr<const container_type> container;
+
+	// Aggregates container entries to string.
+	// Used for `__str__()` and `__repr__()` methods.
+	[[nodiscard]]
+	inline std::string aggregate() const
+	{
+		std::string res = "{";
+		for (auto it = this->container->begin(); it != this->container->end(); it++)
+		{
+			if (it != this->container->begin())
+			{
+				res += ", ";
+			}
+
+			res += "{" + it->first.__repr__() + ", " + it->second.__repr__() + "}";
+		}
+
+		return res + "}";
+	}
+
+public:
+
+	// Refers to `value` without owning it.
+	inline explicit MapView(const container_type& value) : container(_borrow(value))
+	{
+	}
+
+	// Shares ownership of `value`.
+	//
+	// Throws `NullPointerException` if `value` is `nullptr`.
+	inline explicit MapView(std::shared_ptr<const container_type> value) : container(std::move(value))
+	{
+		if (!this->container)
+		{
+			throw NullPointerException("container is nullptr", _ERROR_DETAILS_);
+		}
+	}
+
+	// Iterates through map container in given direction. Reversed
+	// iteration requires bidirectional iterators of the container.
+	//
+	// `func`: function which handles key, value and index.
+	// `reversed`: iteration direction option.
+	inline void look_through(
+		const std::function<void(size_t, const obj::Object*, const obj::Object*)>& func, bool reversed
+	) const override
+	{
+		size_t i = 0;
+		if (reversed)
+		{
+			if constexpr (std::bidirectional_iterator<const_iterator>)
+			{
+				for (auto it = this->container->rbegin(); it != this->container->rend(); it++)
+				{
+					func(i++, &it->first, &it->second);
+				}
+			}
+			else
+			{
+				throw TypeError(
+					"reversed iteration is not supported by '" + this->__type__().name() + "'", _ERROR_DETAILS_
+				);
+			}
+		}
+		else
+		{
+			for (const auto& entry : *this->container)
+			{
+				func(i++, &entry.first, &entry.second);
+			}
+		}
+	}
+
+	[[nodiscard]]
+	inline const_iterator begin() const
+	{
+		return this->container->begin();
+	}
+
+	[[nodiscard]]
+	inline const_iterator end() const
+	{
+		return this->container->end();
+	}
+
+	// Returns `true` if container is empty, `false` otherwise.
+	[[nodiscard]]
+	inline bool empty() const override
+	{
+		return this->container->empty();
+	}
+
+	// Returns the size of the container.
+	[[nodiscard]]
+	inline size_t size() const override
+	{
+		return this->container->size();
+	}
+
+	// Returns the viewed container.
+	inline const container_type& operator* () const
+	{
+		return *this->container;
+	}
+
+	// Compares two views of the same container type. Views of unordered
+	// containers can only be checked for equality.
+	//
+	// Throws `TypeError` if `other` has different type.
+	[[nodiscard]]
+	inline short __cmp__(const Object* other) const override
+	{
+		if (auto other_v = dynamic_cast<const MapView<container_type>*>(other))
+		{
+			if (*this->container == *other_v->container)
+			{
+				return 0;
+			}
+
+			if constexpr (requires (const container_type& c) { c < c; })
+			{
+				return *this->container > *other_v->container ? 1 : -1;
+			}
+			else
+			{
+				throw TypeError(
+					"'__cmp__' is not supported for unequal instances of '" + this->__type__().name() + "'",
+					_ERROR_DETAILS_
+				);
+			}
+		}
+
+		throw TypeError(
+			"'__cmp__' not supported between instances of '" + this->__type__().name() +
+			"' and '" + other->__type__().name() + "'",
+			_ERROR_DETAILS_
+		);
+	}
+
+	// Returns string representation of the container.
+	[[nodiscard]]
+	inline std::string __str__() const override
+	{
+		return this->aggregate();
+	}
+
+	// Returns string representation of the container using
+	// __repr__() method of container's values.
+	[[nodiscard]]
+	inline std::string __repr__() const override
+	{
+		return this->aggregate();
+	}
+};
+
+__TYPES_END__
@@ -7,7 +7,6 @@
 #include "./letter.h"
 
 // Base libraries.
-#include "./tables.h"
 #include "../string_utils.h"
 
 
@@ -15,48 +14,12 @@ __UNICODE_BEGIN__
 
 uint32_t simple_fold(uint32_t c)
 {
-	if (c < 0 || c > MAX_WCHAR_T)
+	if (c > MAX_WCHAR_T)
 	{
 		return c;
 	}
 
-	if ((int)c < ASCII_FOLD.size())
-	{
-		return ASCII_FOLD[c];
-	}
-
-	// Consult CASE_ORBIT table for special cases.
-	size_t lo = 0;
-	auto hi = CASE_ORBIT.size();
-
-	while (lo < hi)
-	{
-		auto m = lo + (hi - lo) / 2;
-		if (CASE_ORBIT[m].from < c)
-		{
-			lo = m + 1;
-		}
-		else
-		{
-			hi = m;
-		}
-	}
-
-	if (lo < CASE_ORBIT.size() && CASE_ORBIT[lo].from == c)
-	{
-		return CASE_ORBIT[lo].to;
-	}
-
-	// No folding specified. This is a one- or two-element
-	// equivalence class containing rune and to_lower(wchar_t)
-	// and to_upper(wchar_t) if they are different from rune.
-	auto l = to_lower(c);
-	if (l != c)
-	{
-		return l;
-	}
-
-	return to_upper(c);
+	return c + char_record(c).fold;
 }
 
 std::pair<uint32_t, bool> _to(Case case_, uint32_t c, const std::vector<CaseRange>& case_range)
@@ -109,8 +72,18 @@ std::pair<uint32_t, bool> _to(Case case_, uint32_t c, const std::vector<CaseRang
 
 uint32_t to(Case case_, uint32_t c)
 {
-	auto [r, _] = _to(case_, c, CASE_RANGES);
-	return r;
+	const auto& record = char_record(c);
+	switch (case_)
+	{
+		case Case::Upper:
+			return c + record.upper;
+		case Case::Lower:
+			return c + record.lower;
+		case Case::Title:
+			return c + record.title;
+		default:
+			return REPLACEMENT_CHAR;
+	}
 }
 
 uint32_t to_upper(uint32_t c)
@@ -125,7 +98,7 @@ uint32_t to_upper(uint32_t c)
 		return c;
 	}
 
-	return to(Case::Upper, c);
+	return c + char_record(c).upper;
 }
 
 uint32_t to_lower(uint32_t c)
@@ -140,7 +113,7 @@ uint32_t to_lower(uint32_t c)
 		return c;
 	}
 
-	return to(Case::Lower, c);
+	return c + char_record(c).lower;
 }
 
 __UNICODE_END__
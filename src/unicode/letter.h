@@ -16,10 +16,34 @@
 // Module definitions.
 #include "./_def_.h"
 
+// Base libraries.
+#include "./lookup_tables.h"
+
 
 __UNICODE_BEGIN__
 
-// TESTME: simple_fold
+// Returns the lookup record of `c` in constant time, without searching
+// range tables. Code points which are not covered by the tables, including
+// invalid ones, have a record with zero deltas and no flags.
+inline const CharRecord& char_record(uint32_t c)
+{
+	if (c >= LOOKUP_MAX)
+	{
+		return CHAR_RECORDS[0];
+	}
+
+	return CHAR_RECORDS[LOOKUP_STAGE_2[
+		(LOOKUP_STAGE_1[c >> LOOKUP_BLOCK_SHIFT] << LOOKUP_BLOCK_SHIFT) | (c & ((1 << LOOKUP_BLOCK_SHIFT) - 1))
+	]];
+}
+
+// Reports whether the code point is a space character as defined
+// by Unicode's White Space property.
+inline bool is_space(uint32_t c)
+{
+	return char_record(c).flags & CHAR_FLAG_WHITE_SPACE;
+}
+
 //
 // Iterates over Unicode code points equivalent under
 // the Unicode-defined simple case folding. Among the code points
@@ -41,17 +65,15 @@ __UNICODE_BEGIN__
 //
 extern uint32_t simple_fold(uint32_t c);
 
-// TESTME: _to
+// Maps the wide char to given case using binary search over `case_range`.
 extern std::pair<uint32_t, bool> _to(Case case_, uint32_t c, const std::vector<CaseRange>& case_range);
 
-// TESTME: to
+// Maps the wide char to given case.
 extern uint32_t to(Case case_, uint32_t c);
 
-// TESTME: to_upper
 // Maps the wide char to upper case.
 extern uint32_t to_upper(uint32_t c);
 
-// TESTME: to_lower
 // Maps the wide char to lower case.
 extern uint32_t to_lower(uint32_t c);
 
@@ -6,6 +6,13 @@
 
 #include "./utf8.h"
 
+// C++ libraries.
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 
 __UNICODE_UTF8_BEGIN__
 
@@ -134,4 +141,339 @@ std::tuple<uint32_t, size_t> decode_symbol(const std::string& s)
 	return {(s0_ & mask4) << 18 | (s1_ & maskx) << 12 | (s2_ & maskx) << 6 | (s3_ & maskx), 4};
 }
 
+// Returns the length of ASCII prefix of 'data'. The input is checked
+// by 16 bytes with SSE2 or by 8 bytes otherwise.
+static inline size_t _ascii_prefix(const uint8_t* data, size_t size)
+{
+	size_t i = 0;
+#if defined(__SSE2__)
+	for (; i + 16 <= size; i += 16)
+	{
+		auto mask = (unsigned)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(data + i)));
+		if (mask)
+		{
+			return i + __builtin_ctz(mask);
+		}
+	}
+#endif
+	for (; i + 8 <= size; i += 8)
+	{
+		uint64_t word;
+		std::memcpy(&word, data + i, 8);
+		if (word & 0x8080808080808080ULL)
+		{
+			break;
+		}
+	}
+
+	while (i < size && data[i] < BYTE_SELF)
+	{
+		i++;
+	}
+
+	return i;
+}
+
+// Decodes one multibyte sequence which starts with non-ASCII byte.
+// On success, sets 'c' and 'width' and returns 'Error::None'.
+static inline Error _decode_multibyte(const uint8_t* data, size_t size, uint32_t& c, size_t& width)
+{
+	auto x = first[data[0]];
+	if (x >= as)
+	{
+		return Error::Invalid;
+	}
+
+	auto sz = (size_t)(x & 7);
+	auto accept = acceptRanges[x >> 4];
+	if (size < 2)
+	{
+		return Error::Truncated;
+	}
+
+	if (data[1] < accept.lo || accept.hi < data[1])
+	{
+		return Error::Invalid;
+	}
+
+	if (sz == 2)
+	{
+		c = (data[0] & mask2) << 6 | (data[1] & maskx);
+		width = 2;
+		return Error::None;
+	}
+
+	if (size < 3)
+	{
+		return Error::Truncated;
+	}
+
+	if (data[2] < locb || hicb < data[2])
+	{
+		return Error::Invalid;
+	}
+
+	if (sz == 3)
+	{
+		c = (data[0] & mask3) << 12 | (data[1] & maskx) << 6 | (data[2] & maskx);
+		width = 3;
+		return Error::None;
+	}
+
+	if (size < 4)
+	{
+		return Error::Truncated;
+	}
+
+	if (data[3] < locb || hicb < data[3])
+	{
+		return Error::Invalid;
+	}
+
+	c = (data[0] & mask4) << 18 | (data[1] & maskx) << 12 | (data[2] & maskx) << 6 | (data[3] & maskx);
+	width = 4;
+	return Error::None;
+}
+
+// Writes UTF-8 encoding of valid code point 'c' to 'out' and
+// returns its width.
+static inline size_t _encode(uint32_t c, char* out)
+{
+	if (c < 0x80)
+	{
+		out[0] = (char)c;
+		return 1;
+	}
+
+	if (c < 0x800)
+	{
+		out[0] = (char)(0xC0 | (c >> 6));
+		out[1] = (char)(0x80 | (c & maskx));
+		return 2;
+	}
+
+	if (c < 0x10000)
+	{
+		out[0] = (char)(0xE0 | (c >> 12));
+		out[1] = (char)(0x80 | ((c >> 6) & maskx));
+		out[2] = (char)(0x80 | (c & maskx));
+		return 3;
+	}
+
+	out[0] = (char)(0xF0 | (c >> 18));
+	out[1] = (char)(0x80 | ((c >> 12) & maskx));
+	out[2] = (char)(0x80 | ((c >> 6) & maskx));
+	out[3] = (char)(0x80 | (c & maskx));
+	return 4;
+}
+
+// Decodes UTF-8 input and passes each non-ASCII code point to 'put',
+// while ASCII runs are passed to 'put_ascii'. 'put' returns 'false'
+// if the code point can not be written.
+template <typename AsciiFunc, typename Func>
+static inline Result _transcode_utf8(std::string_view s, AsciiFunc put_ascii, Func put)
+{
+	auto data = (const uint8_t*)s.data();
+	auto size = s.size();
+	size_t i = 0;
+	while (i < size)
+	{
+		auto run = _ascii_prefix(data + i, size - i);
+		put_ascii(data + i, run);
+		i += run;
+		if (i == size)
+		{
+			break;
+		}
+
+		uint32_t c;
+		size_t width;
+		auto error = _decode_multibyte(data + i, size - i, c, width);
+		if (error != Error::None)
+		{
+			return {error, i};
+		}
+
+		if (!put(c))
+		{
+			return {Error::OutOfRange, i};
+		}
+
+		i += width;
+	}
+
+	return {Error::None, 0};
+}
+
+Result validate_utf8(std::string_view s)
+{
+	auto result = _transcode_utf8(s, [](auto, auto) {}, [](auto) { return true; });
+	if (result.ok())
+	{
+		result.count = s.size();
+	}
+
+	return result;
+}
+
+Result utf8_to_latin1(std::string_view s, char* out)
+{
+	auto begin = out;
+	auto result = _transcode_utf8(
+		s,
+		[&out](const uint8_t* data, size_t size) {
+			std::memcpy(out, data, size);
+			out += size;
+		},
+		[&out](uint32_t c) {
+			if (c > MAX_LATIN_1)
+			{
+				return false;
+			}
+
+			*out++ = (char)c;
+			return true;
+		}
+	);
+	if (result.ok())
+	{
+		result.count = out - begin;
+	}
+
+	return result;
+}
+
+Result latin1_to_utf8(std::string_view s, char* out)
+{
+	auto data = (const uint8_t*)s.data();
+	auto size = s.size();
+	auto begin = out;
+	size_t i = 0;
+	while (i < size)
+	{
+		auto run = _ascii_prefix(data + i, size - i);
+		std::memcpy(out, data + i, run);
+		out += run;
+		i += run;
+		for (; i < size && data[i] >= BYTE_SELF; i++)
+		{
+			*out++ = (char)(0xC0 | (data[i] >> 6));
+			*out++ = (char)(0x80 | (data[i] & maskx));
+		}
+	}
+
+	return {Error::None, (size_t)(out - begin)};
+}
+
+Result utf8_to_utf16(std::string_view s, char16_t* out)
+{
+	auto begin = out;
+	auto result = _transcode_utf8(
+		s,
+		[&out](const uint8_t* data, size_t size) {
+			for (size_t i = 0; i < size; i++)
+			{
+				*out++ = data[i];
+			}
+		},
+		[&out](uint32_t c) {
+			if (c < 0x10000)
+			{
+				*out++ = (char16_t)c;
+			}
+			else
+			{
+				c -= 0x10000;
+				*out++ = (char16_t)(0xD800 + (c >> 10));
+				*out++ = (char16_t)(0xDC00 + (c & 0x3FF));
+			}
+
+			return true;
+		}
+	);
+	if (result.ok())
+	{
+		result.count = out - begin;
+	}
+
+	return result;
+}
+
+Result utf16_to_utf8(std::u16string_view s, char* out)
+{
+	auto begin = out;
+	auto size = s.size();
+	for (size_t i = 0; i < size; i++)
+	{
+		uint32_t c = s[i];
+		if (c < 0x80)
+		{
+			*out++ = (char)c;
+			continue;
+		}
+
+		if (c >= 0xD800 && c <= 0xDFFF)
+		{
+			if (c > 0xDBFF || i + 1 == size || s[i + 1] < 0xDC00 || s[i + 1] > 0xDFFF)
+			{
+				return {Error::Surrogate, i};
+			}
+
+			c = 0x10000 + ((c - 0xD800) << 10) + (s[i + 1] - 0xDC00);
+			i++;
+		}
+
+		out += _encode(c, out);
+	}
+
+	return {Error::None, (size_t)(out - begin)};
+}
+
+Result utf8_to_utf32(std::string_view s, char32_t* out)
+{
+	auto begin = out;
+	auto result = _transcode_utf8(
+		s,
+		[&out](const uint8_t* data, size_t size) {
+			for (size_t i = 0; i < size; i++)
+			{
+				*out++ = data[i];
+			}
+		},
+		[&out](uint32_t c) {
+			*out++ = c;
+			return true;
+		}
+	);
+	if (result.ok())
+	{
+		result.count = out - begin;
+	}
+
+	return result;
+}
+
+Result utf32_to_utf8(std::u32string_view s, char* out)
+{
+	auto begin = out;
+	auto size = s.size();
+	for (size_t i = 0; i < size; i++)
+	{
+		auto c = (uint32_t)s[i];
+		if (c > (uint32_t)MAX_WCHAR_T)
+		{
+			return {Error::OutOfRange, i};
+		}
+
+		if (c >= 0xD800 && c <= 0xDFFF)
+		{
+			return {Error::Surrogate, i};
+		}
+
+		out += _encode(c, out);
+	}
+
+	return {Error::None, (size_t)(out - begin)};
+}
+
 __UNICODE_UTF8_END__
@@ -12,6 +12,7 @@
 
 // C++ libraries.
 #include <string>
+#include <string_view>
 #include <tuple>
 
 // Module definitions.
@@ -26,4 +27,68 @@ __UNICODE_UTF8_BEGIN__
 // Otherwise, if the encoding is invalid, it throws 'EncodingError'.
 std::tuple<uint32_t, size_t> decode_symbol(const std::string& s);
 
+// Error codes of bulk validation and transcoding functions.
+enum class Error
+{
+	None = 0,
+
+	// Sequence is not valid UTF-8: wrong leading byte, bad continuation
+	// byte, overlong encoding, encoded surrogate or value above U+10FFFF.
+	Invalid,
+
+	// Input ends in the middle of valid, but incomplete sequence.
+	Truncated,
+
+	// Unpaired UTF-16 surrogate or surrogate code point in UTF-32.
+	Surrogate,
+
+	// Code point can not be represented in target encoding.
+	OutOfRange
+};
+
+// Result of bulk validation and transcoding.
+//
+// `error`: 'Error::None' on success.
+// `count`: number of written code units on success, otherwise the
+// position of the first invalid code unit in the input.
+struct Result
+{
+	Error error;
+	size_t count;
+
+	[[nodiscard]]
+	inline bool ok() const
+	{
+		return this->error == Error::None;
+	}
+};
+
+// 'validate_utf8' checks if 's' is valid UTF-8. On success 'count' of
+// the result is the size of 's'.
+extern Result validate_utf8(std::string_view s);
+
+// 'utf8_to_latin1' converts UTF-8 to ISO-8859-1. The 'out' buffer must
+// have at least 's.size()' bytes.
+extern Result utf8_to_latin1(std::string_view s, char* out);
+
+// 'latin1_to_utf8' converts ISO-8859-1 to UTF-8, it never fails. The 'out'
+// buffer must have at least '2 * s.size()' bytes.
+extern Result latin1_to_utf8(std::string_view s, char* out);
+
+// 'utf8_to_utf16' converts UTF-8 to UTF-16. The 'out' buffer must have at
+// least 's.size()' code units.
+extern Result utf8_to_utf16(std::string_view s, char16_t* out);
+
+// 'utf16_to_utf8' converts UTF-16 to UTF-8. The 'out' buffer must have at
+// least '3 * s.size()' bytes.
+extern Result utf16_to_utf8(std::u16string_view s, char* out);
+
+// 'utf8_to_utf32' converts UTF-8 to UTF-32. The 'out' buffer must have at
+// least 's.size()' code units.
+extern Result utf8_to_utf32(std::string_view s, char32_t* out);
+
+// 'utf32_to_utf8' converts UTF-32 to UTF-8. The 'out' buffer must have at
+// least '4 * s.size()' bytes.
+extern Result utf32_to_utf8(std::u32string_view s, char* out);
+
 __UNICODE_UTF8_END__
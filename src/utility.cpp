@@ -14,6 +14,7 @@
 #endif
 
 // Base libraries.
+#include "./datetime_format.h"
 #include "./string_utils.h"
 
 
@@ -22,8 +23,18 @@ __UTILITY_BEGIN__
 std::string format_datetime(const dt::Datetime* dt, bool use_gmt)
 {
 	assert(dt != nullptr);
-	auto now = dt->time_tuple();
-	std::string zone;
+
+	// Date and time, space and the longest zone, '+HHMMSS.ffffff'.
+	char buffer[25 + 1 + 14];
+	dt::DatetimeFields fields;
+	fields.year = dt->year();
+	fields.month = dt->month();
+	fields.day = dt->day();
+	fields.hour = dt->hour();
+	fields.minute = dt->minute();
+	fields.second = dt->second();
+	auto size = dt::_format_imf_date_time(buffer, fields);
+	buffer[size++] = ' ';
 	if (use_gmt)
 	{
 		if (!dt->tz_info() || *dt->tz_info() != dt::Timezone::UTC)
@@ -31,18 +42,22 @@ std::string format_datetime(const dt::Datetime* dt, bool use_gmt)
 			throw std::invalid_argument("use_gmt option requires a UTC datetime");
 		}
 
-		zone = "GMT";
+		std::memcpy(buffer + size, "GMT", 3);
+		size += 3;
 	}
 	else if (!dt->tz_info())
 	{
-		zone = "-0000";
+		std::memcpy(buffer + size, "-0000", 5);
+		size += 5;
 	}
-	else
+	else if (auto offset = dt->utc_offset())
 	{
-		zone = dt->strftime("%z");
+		size += dt::_format_utc_offset(
+			buffer + size, offset->days() * 86400 + offset->seconds(), offset->microseconds(), false
+		);
 	}
 
-	return _format_timetuple_and_zone(&now, zone);
+	return {buffer, size};
 }
 
 std::string format_date(time_t time_val, bool local_time, bool use_gmt)
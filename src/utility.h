@@ -9,7 +9,13 @@
 #pragma once
 
 // C++ libraries.
+#include <cctype>
+#include <charconv>
 #include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
 
 // Module definitions.
 #include "./_def_.h"
@@ -114,6 +120,91 @@ extern std::string format_date(time_t time_val, bool local_time = false, bool us
 // Returns formatted datetime as `std::string`.
 extern std::string _format_timetuple_and_zone(dt::tm_tuple* time_tuple, const std::string& zone);
 
+// Parses a number of type `T` at the beginning of `s` with
+// `std::from_chars`, which does not depend on locale and does not
+// throw. Leading whitespace and plus sign are skipped and characters
+// after the number are ignored, as `std::strtol` and `std::strtod` do.
+// Negative numbers are not accepted for unsigned `T`.
+//
+// Returns `std::errc::invalid_argument` if `s` does not start with a
+// number and `std::errc::result_out_of_range` if the number does not
+// fit `T`. `result` is changed only on success.
+template <typename T>
+requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>)
+inline std::errc parse_number(std::string_view s, T& result)
+{
+	auto begin = s.data();
+	auto end = s.data() + s.size();
+	while (begin != end && std::isspace((unsigned char)*begin))
+	{
+		begin++;
+	}
+
+	if (begin != end && *begin == '+')
+	{
+		begin++;
+		if (begin != end && *begin == '-')
+		{
+			return std::errc::invalid_argument;
+		}
+	}
+
+	T value;
+	auto [_, error] = std::from_chars(begin, end, value);
+	if (error == std::errc())
+	{
+		result = value;
+	}
+
+	return error;
+}
+
+// Converts `s` to `T` without throwing exceptions. Numbers are parsed
+// by `parse_number`, strings are copied.
+//
+// Returns `std::nullopt` if `s` is not a number or it does not fit `T`.
+template <typename T>
+inline std::optional<T> try_as(std::string_view s)
+{
+	if constexpr (std::is_same_v<T, std::string>)
+	{
+		return std::string(s);
+	}
+	else
+	{
+		T result;
+		if (parse_number(s, result) == std::errc())
+		{
+			return result;
+		}
+
+		return std::nullopt;
+	}
+}
+
+// Same as `parse_number`, but throws exceptions the same way as
+// `std::stoi` family.
+//
+// Throws `std::invalid_argument` if `data` does not start with a number
+// and `std::out_of_range` if the number does not fit `T`.
+template <typename T>
+inline T _as_number(const char* data)
+{
+	T result;
+	auto error = parse_number(std::string_view(data), result);
+	if (error == std::errc::invalid_argument)
+	{
+		throw std::invalid_argument("as: no conversion of '" + std::string(data) + "'");
+	}
+
+	if (error == std::errc::result_out_of_range)
+	{
+		throw std::out_of_range("as: '" + std::string(data) + "' is out of range");
+	}
+
+	return result;
+}
+
 template<typename T>
 struct ItemReturn{ typedef T type; };
 
@@ -127,7 +218,7 @@ struct ItemReturn<short int>{ typedef short int type; };
 template<>
 inline short int as<short int>(const void* data)
 {
-	return (short int)std::stoi((const char*)data);
+	return _as_number<short int>((const char*)data);
 }
 
 // TESTME: as<unsigned short int>
@@ -137,7 +228,7 @@ struct ItemReturn<unsigned short int>{ typedef unsigned short int type; };
 template<>
 inline unsigned short int as<unsigned short int>(const void* data)
 {
-	return std::stoi((const char*)data);
+	return _as_number<unsigned short int>((const char*)data);
 }
 
 // TESTME: as<unsigned int>
@@ -147,7 +238,7 @@ struct ItemReturn<unsigned int>{ typedef unsigned int type; };
 template<>
 inline unsigned int as<unsigned int>(const void* data)
 {
-	return std::stoi((const char*)data);
+	return _as_number<unsigned int>((const char*)data);
 }
 
 // TESTME: as<int>
@@ -157,7 +248,7 @@ struct ItemReturn<int>{ typedef int type; };
 template<>
 inline int as<int>(const void* data)
 {
-	return std::stoi((const char*)data);
+	return _as_number<int>((const char*)data);
 }
 
 // TESTME: as<long int>
@@ -167,7 +258,7 @@ struct ItemReturn<long int>{ typedef long int type; };
 template<>
 inline long int as<long int>(const void* data)
 {
-	return std::stol((const char*)data);
+	return _as_number<long int>((const char*)data);
 }
 
 // TESTME: as<unsigned long int>
@@ -177,7 +268,7 @@ struct ItemReturn<unsigned long int>{ typedef unsigned long int type; };
 template<>
 inline unsigned long int as<unsigned long int>(const void* data)
 {
-	return std::stoul((const char*)data);
+	return _as_number<unsigned long int>((const char*)data);
 }
 
 // TESTME: as<long long int>
@@ -187,7 +278,7 @@ struct ItemReturn<long long int>{ typedef long long int type; };
 template<>
 inline long long int as<long long int>(const void* data)
 {
-	return std::stoll((const char*)data);
+	return _as_number<long long int>((const char*)data);
 }
 
 // TESTME: as<unsigned long long int>
@@ -197,7 +288,7 @@ struct ItemReturn<unsigned long long int>{ typedef unsigned long long int type;
 template<>
 inline unsigned long long int as<unsigned long long int>(const void* data)
 {
-	return std::stoull((const char*)data);
+	return _as_number<unsigned long long int>((const char*)data);
 }
 
 // TESTME: as<float>
@@ -207,7 +298,7 @@ struct ItemReturn<float>{ typedef float type; };
 template<>
 inline float as<float>(const void* data)
 {
-	return std::stof((const char*)data);
+	return _as_number<float>((const char*)data);
 }
 
 // TESTME: as<double>
@@ -217,7 +308,7 @@ struct ItemReturn<double>{ typedef double type; };
 template<>
 inline double as<double>(const void* data)
 {
-	return std::stod((const char*)data);
+	return _as_number<double>((const char*)data);
 }
 
 // TESTME: as<long double>
@@ -227,7 +318,7 @@ struct ItemReturn<long double>{ typedef long double type; };
 template<>
 inline long double as<long double>(const void* data)
 {
-	return std::stold((const char*)data);
+	return _as_number<long double>((const char*)data);
 }
 
 // TESTME: as<std::string>
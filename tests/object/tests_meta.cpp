@@ -4,6 +4,9 @@
  * Copyright (c) 2021 Yuriy Lisovskiy
  */
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "../../src/object/meta.h"
@@ -90,6 +93,62 @@ TEST(TestCase_Type, operator_equals_False)
 	ASSERT_FALSE(object1.__type__() == object2.__type__());
 }
 
+TEST(TestCase_Type, IsCachedPerType)
+{
+	CustomObject object1, object2;
+	ASSERT_EQ(&object1.__type__(), &object2.__type__());
+	ASSERT_EQ(&object1.__type__(), &obj::meta::type_of<CustomObject>());
+
+	obj::Object* base = &object1;
+	ASSERT_EQ(&base->__type__(), &object1.__type__());
+}
+
+TEST(TestCase_Type, Ids)
+{
+	CustomObject object1;
+	some_ns::inner_ns::AnotherCustomObject object2;
+	ASSERT_GT(object1.__type__().id(), 0);
+	ASSERT_NE(object1.__type__().id(), object2.__type__().id());
+	ASSERT_EQ(object1.__type__().id(), obj::meta::type_id<CustomObject>());
+	ASSERT_EQ(object2.__type__().id(), obj::meta::type_id<some_ns::inner_ns::AnotherCustomObject>());
+	ASSERT_EQ(obj::meta::type_id<int>(), obj::meta::Type::of(typeid(int)).id());
+}
+
+namespace
+{
+	template<int N>
+	class NumberedObject : public obj::Object
+	{
+	};
+}
+
+TEST(TestCase_Type, ConcurrentLookups)
+{
+	std::vector<std::vector<const obj::meta::Type*>> results(8);
+	std::vector<std::thread> threads;
+	for (auto& result : results)
+	{
+		threads.emplace_back([&result]() {
+			result.push_back(&NumberedObject<1>().__type__());
+			result.push_back(&NumberedObject<2>().__type__());
+			result.push_back(&NumberedObject<3>().__type__());
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (auto& result : results)
+	{
+		ASSERT_EQ(result, results[0]);
+	}
+
+	ASSERT_NE(results[0][0]->id(), results[0][1]->id());
+	ASSERT_NE(results[0][1]->id(), results[0][2]->id());
+}
+
 TEST(TestCase_type_name, getObjectTypeNameWithoutNamespace)
 {
 	ASSERT_EQ(obj::meta::type_name<CustomObject>(), "CustomObject");
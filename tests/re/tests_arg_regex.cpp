@@ -95,3 +95,24 @@ TEST_F(TestCase_ArgRegex, str)
 		this->regex.to_string(), R"(accounts/<id>(\d+)/picture/<name>(\w+\.jpeg))"
 	);
 }
+
+TEST_F(TestCase_ArgRegex, find_Found)
+{
+	std::string input = "accounts/1/picture/flower.jpeg";
+	auto match = this->regex.find(input);
+	ASSERT_TRUE(match);
+	ASSERT_EQ(this->regex.arg(match, "id"), "1");
+	ASSERT_EQ(this->regex.arg(match, "name"), "flower.jpeg");
+	ASSERT_EQ(this->regex.arg(match, "other", "default"), "default");
+	ASSERT_EQ(this->regex.keys(), std::vector<std::string>({"id", "name"}));
+
+	// The object itself is not changed.
+	ASSERT_EQ(this->regex.args().size(), 0);
+}
+
+TEST_F(TestCase_ArgRegex, find_NotFound)
+{
+	re::Match match;
+	ASSERT_FALSE(this->regex.find("accounts/-1/picture/flower.jpeg", match));
+	ASSERT_EQ(this->regex.arg(match, "id"), "");
+}
@@ -0,0 +1,173 @@
+/**
+ * re/tests_cache.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../src/re/cache.h"
+#include "../../src/re/regex.h"
+
+using namespace xw;
+
+
+TEST(TestCase_compile, SamePatternIsCompiledOnce)
+{
+	auto first = re::compile("cache-test-[0-9]+");
+	auto size = re::cache_size();
+	auto second = re::compile("cache-test-[0-9]+");
+	ASSERT_EQ(first.get(), second.get());
+	ASSERT_EQ(re::cache_size(), size);
+}
+
+TEST(TestCase_compile, DifferentOptionsAreCompiledSeparately)
+{
+	auto first = re::compile("cache-test-[a-z]+");
+	auto second = re::compile("cache-test-[a-z]+", std::regex_constants::icase);
+	auto third = re::compile("cache-test-[a-z]+", std::regex_constants::ECMAScript, re::Engine::Std);
+	ASSERT_NE(first.get(), second.get());
+	ASSERT_NE(first.get(), third.get());
+	ASSERT_TRUE(second->match("CACHE-TEST-ABC"));
+	ASSERT_FALSE(first->match("CACHE-TEST-ABC"));
+}
+
+TEST(TestCase_compile, ErrorIsNotCached)
+{
+	auto size = re::cache_size();
+	ASSERT_THROW(re::compile("cache-test-(", std::regex_constants::ECMAScript, re::Engine::Std), std::regex_error);
+	ASSERT_EQ(re::cache_size(), size);
+}
+
+TEST(TestCase_compile, RegexSharesCompiledPattern)
+{
+	auto size = re::cache_size();
+	re::Regex first("cache-test-shared");
+	re::Regex second("cache-test-shared");
+	ASSERT_EQ(re::cache_size(), size + 1);
+}
+
+TEST(TestCase_compile, SharedRegexFromManyThreads)
+{
+	const re::Regex regex(R"(([a-z]+)=(\d+))");
+	std::vector<std::thread> threads;
+	std::vector<size_t> found(8, 0);
+	for (size_t t = 0; t < found.size(); t++)
+	{
+		threads.emplace_back([&regex, &found, t]() {
+			std::string input = "a=1; key=" + std::to_string(t) + "; zzz=42";
+			for (size_t i = 0; i < 500; i++)
+			{
+				for (const auto& match : regex.find_all(input))
+				{
+					if (match.group(1) == "key" && match.group(2) == std::to_string(t))
+					{
+						found[t]++;
+					}
+				}
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	ASSERT_EQ(found, std::vector<size_t>(found.size(), 500));
+}
+
+class TestCase_compile_Capacity : public ::testing::Test
+{
+protected:
+	size_t capacity = 0;
+
+	void SetUp() override
+	{
+		this->capacity = re::cache_capacity();
+	}
+
+	void TearDown() override
+	{
+		re::set_cache_capacity(this->capacity);
+	}
+};
+
+TEST_F(TestCase_compile_Capacity, LeastRecentlyUsedIsEvicted)
+{
+	re::set_cache_capacity(2);
+	ASSERT_LE(re::cache_size(), 2);
+
+	auto first = re::compile("cache-capacity-1");
+	auto second = re::compile("cache-capacity-2");
+	ASSERT_EQ(re::compile("cache-capacity-1").get(), first.get());
+
+	re::compile("cache-capacity-3");
+	ASSERT_EQ(re::cache_size(), 2);
+	ASSERT_EQ(re::compile("cache-capacity-1").get(), first.get());
+	ASSERT_NE(re::compile("cache-capacity-2").get(), second.get());
+}
+
+TEST_F(TestCase_compile_Capacity, ZeroDisablesCaching)
+{
+	re::set_cache_capacity(0);
+	ASSERT_EQ(re::cache_size(), 0);
+	auto first = re::compile("cache-capacity-none");
+	ASSERT_NE(re::compile("cache-capacity-none").get(), first.get());
+	ASSERT_TRUE(first->match("cache-capacity-none"));
+	ASSERT_EQ(re::cache_size(), 0);
+}
+
+TEST(TestCase_compile, ConcurrentCallersShareOnePattern)
+{
+	std::vector<std::thread> threads;
+	std::vector<std::shared_ptr<const re::IEngine>> patterns(8);
+	for (size_t i = 0; i < patterns.size(); i++)
+	{
+		threads.emplace_back([&patterns, i]() {
+			patterns[i] = re::compile("cache-concurrent-(a|b)*c", std::regex_constants::ECMAScript, re::Engine::Std);
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (const auto& pattern : patterns)
+	{
+		ASSERT_EQ(pattern.get(), patterns[0].get());
+	}
+}
+
+TEST(TestCase_compile, ConcurrentErrorIsNotCached)
+{
+	auto size = re::cache_size();
+	std::vector<std::thread> threads;
+	std::atomic<size_t> errors = 0;
+	for (size_t i = 0; i < 4; i++)
+	{
+		threads.emplace_back([&errors]() {
+			try
+			{
+				re::compile("cache-concurrent-(", std::regex_constants::ECMAScript, re::Engine::Std);
+			}
+			catch (const std::regex_error&)
+			{
+				errors++;
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	ASSERT_EQ(errors, 4);
+	ASSERT_EQ(re::cache_size(), size);
+}
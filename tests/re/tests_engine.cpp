@@ -0,0 +1,149 @@
+/**
+ * re/tests_engine.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../src/exceptions.h"
+#include "../../src/re/engine.h"
+#include "../../src/re/nfa.h"
+#include "../../src/re/regex.h"
+
+using namespace xw;
+
+
+struct DifferentialCase
+{
+	std::string pattern;
+	std::vector<std::string> inputs;
+};
+
+static const std::vector<DifferentialCase> DIFFERENTIAL_CASES = {
+	{R"((?:W\/)?"[^"]*")", {R"(W/"0815"W/"0821")", R"("bfc13a64729c4290ef5b2c2730249c88ca92d82d")", "none"}},
+	{R"([A-Za-z]+)", {"Some 100 text", "", "100"}},
+	{
+		R"((?:[^\s'"]*(?:(?:"(?:[^"\\]|\\.)*"|'(?:[^'\\]|\\.)*')[^\s'"]*)+)|\S+)",
+		{
+			R"(This is "a person's" test.)", R"(Another 'person\'s' test.)",
+			R"(A "\"funky\" style" test.)", R"(url 'path/to/page' key="value with spaces" 'unclosed)", "   "
+		}
+	},
+	{R"((a|ab)(c|bcd)(d*))", {"abcd", "xabcdd"}},
+	{R"((ab)*c)", {"ababc", "abab", "c"}},
+	{R"((a*?)(a+))", {"aaaa"}},
+	{R"(^\d{2,4}-\d{1,2}$)", {"2021-05", "21-5", "12345-1", "2021-055"}},
+	{R"(\bfoo\b|\Bbar)", {"foo bar", "foobar", "a foo", "xbar"}},
+	{R"(x{3}|y{2,}|z{0,1}w)", {"xxxx", "yyyyy", "zw", "w", "zzw"}},
+	{R"(([a-c])(\1)?)", {"aa"}},
+	{R"((\w+)@(\w+)\.com)", {"mail john@example.com now", "nobody@example.org"}},
+	{R"([^\x41-\x5a\d]+)", {"ABCdef123ghi"}},
+	{R"(.+)", {"line\nnext", ""}},
+	{R"((?:(a)|b)+)", {"ab", "ba"}},
+	{R"(a|)", {"b", "a"}},
+};
+
+static std::vector<std::string> _all_groups(re::Engine engine, const std::string& pattern, const std::string& input)
+{
+	re::Regex regex(pattern, engine);
+	regex.search(input);
+	return regex.groups();
+}
+
+TEST(TestCase_NfaEngine, SameAsStdEngine)
+{
+	for (const auto& test_case : DIFFERENTIAL_CASES)
+	{
+		auto nfa = re::NfaEngine::compile(test_case.pattern);
+		if (test_case.pattern.find("\\1") != std::string::npos)
+		{
+			ASSERT_EQ(nfa, nullptr);
+			continue;
+		}
+
+		ASSERT_NE(nfa, nullptr) << test_case.pattern;
+		re::StdEngine std_engine(test_case.pattern);
+		ASSERT_EQ(nfa->groups_count(), std_engine.groups_count());
+		for (const auto& input : test_case.inputs)
+		{
+			ASSERT_EQ(nfa->match(input), std_engine.match(input)) << test_case.pattern << " ~ " << input;
+			ASSERT_EQ(
+				_all_groups(re::Engine::Nfa, test_case.pattern, input),
+				_all_groups(re::Engine::Std, test_case.pattern, input)
+			) << test_case.pattern << " ~ " << input;
+
+			for (size_t start = 0; start <= input.size(); start++)
+			{
+				std::vector<re::GroupOffsets> nfa_groups, std_groups;
+				ASSERT_EQ(
+					nfa->search(input, start, nfa_groups), std_engine.search(input, start, std_groups)
+				) << test_case.pattern << " ~ " << input;
+				ASSERT_EQ(nfa_groups, std_groups) << test_case.pattern << " ~ " << input << " @ " << start;
+			}
+		}
+	}
+}
+
+TEST(TestCase_NfaEngine, compile_Unsupported)
+{
+	for (const auto& pattern : {R"((a)\1)", R"(a(?=b))", R"(a(?!b))", R"((?<=a)b)", "a**", "(a", "a)", "[a"})
+	{
+		ASSERT_EQ(re::NfaEngine::compile(pattern), nullptr) << pattern;
+	}
+}
+
+TEST(TestCase_NfaEngine, LongInputWithoutRecursion)
+{
+	std::string input(200000, 'a');
+	auto nfa = re::NfaEngine::compile("(a|aa)*b");
+	ASSERT_NE(nfa, nullptr);
+	ASSERT_FALSE(nfa->match(input));
+
+	input += 'b';
+	ASSERT_TRUE(nfa->match(input));
+}
+
+TEST(TestCase_NfaEngine, EnginesOfDifferentSizesInTurn)
+{
+	auto large = re::NfaEngine::compile(R"((\w+)-(\d+)-(x|y)-([a-f]+))");
+	auto small = re::NfaEngine::compile("(b+)");
+	ASSERT_NE(large, nullptr);
+	ASSERT_NE(small, nullptr);
+
+	std::vector<re::GroupOffsets> groups;
+	for (int i = 0; i < 3; i++)
+	{
+		ASSERT_TRUE(large->search("..ab-12-y-cafe", 0, groups));
+		ASSERT_EQ(groups.size(), 5);
+		ASSERT_EQ(groups[4].first, 10);
+		ASSERT_EQ(groups[4].second, 14);
+
+		ASSERT_TRUE(small->search("aabbb", 0, groups));
+		ASSERT_EQ(groups.size(), 2);
+		ASSERT_EQ(groups[1].first, 2);
+		ASSERT_EQ(groups[1].second, 5);
+		ASSERT_FALSE(small->match("aa"));
+	}
+}
+
+TEST(TestCase_make_engine, FallbackToStd)
+{
+	auto engine = re::make_engine(R"((a)\1)", std::regex_constants::ECMAScript, re::Engine::Auto);
+	ASSERT_NE(dynamic_cast<const re::StdEngine*>(engine.get()), nullptr);
+	ASSERT_TRUE(engine->match("aa"));
+
+	engine = re::make_engine("[a-z]+", std::regex_constants::icase, re::Engine::Auto);
+	ASSERT_NE(dynamic_cast<const re::StdEngine*>(engine.get()), nullptr);
+	ASSERT_TRUE(engine->match("ABC"));
+
+	engine = re::make_engine("[a-z]+", std::regex_constants::optimize, re::Engine::Auto);
+	ASSERT_NE(dynamic_cast<const re::NfaEngine*>(engine.get()), nullptr);
+}
+
+TEST(TestCase_make_engine, NfaThrowsIfUnsupported)
+{
+	ASSERT_THROW(
+		re::make_engine(R"((a)\1)", std::regex_constants::ECMAScript, re::Engine::Nfa), ValueError
+	);
+}
@@ -88,3 +88,39 @@ TEST_F(TestCase_IterRegex, str)
 {
 	ASSERT_EQ("[A-Za-z]+", this->regex.str());
 }
+
+TEST_F(TestCase_IterRegex, setup_view)
+{
+	std::string input = "Some 100 text";
+	this->regex.setup_view(input);
+	ASSERT_TRUE(this->regex.search_next());
+	ASSERT_EQ(this->regex.match().group(), "Some");
+	ASSERT_EQ(this->regex.match().group().data(), input.data());
+	ASSERT_TRUE(this->regex.search_next());
+	ASSERT_EQ(this->regex.match().group(), "text");
+	ASSERT_EQ(this->regex.match().start(), 9);
+	ASSERT_FALSE(this->regex.search_next());
+	ASSERT_FALSE(this->regex.match());
+}
+
+TEST_F(TestCase_IterRegex, CopyKeepsOwnInput)
+{
+	this->regex.setup("Some 100 text");
+	ASSERT_TRUE(this->regex.search_next());
+	auto copy = this->regex;
+	this->regex.setup("other");
+	ASSERT_EQ(copy.match().group(), "Some");
+	ASSERT_TRUE(copy.search_next());
+	ASSERT_EQ(copy.group(0), "text");
+}
+
+TEST_F(TestCase_IterRegex, find_all)
+{
+	std::vector<std::string_view> actual;
+	for (const auto& match : this->regex.find_all("Some 100 text"))
+	{
+		actual.push_back(match.group());
+	}
+
+	ASSERT_EQ(actual, std::vector<std::string_view>({"Some", "text"}));
+}
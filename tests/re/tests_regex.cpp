@@ -59,6 +59,94 @@ TEST_F(TestCase_Regex, str)
 	ASSERT_EQ(this->regex.str(), R"((?:W\/)?"[^"]*")");
 }
 
+TEST_F(TestCase_Regex, find_Found)
+{
+	std::string input = R"(W/"0815", "0821")";
+	auto match = this->regex.find(input);
+	ASSERT_TRUE(match);
+	ASSERT_EQ(match.group(), R"(W/"0815")");
+	ASSERT_EQ(match.group().data(), input.data());
+	ASSERT_EQ(match.start(), 0);
+	ASSERT_EQ(match.end(), 8);
+
+	match = this->regex.find(input, match.end());
+	ASSERT_TRUE(match);
+	ASSERT_EQ(match.group(), R"("0821")");
+	ASSERT_EQ(match.start(), 10);
+}
+
+TEST_F(TestCase_Regex, find_NotFound)
+{
+	auto match = this->regex.find("none");
+	ASSERT_FALSE(match);
+	ASSERT_EQ(match.size(), 0);
+	ASSERT_EQ(match.group(), "");
+	ASSERT_EQ(match.start(), std::string::npos);
+}
+
+TEST(TestCase_Regex_find, NotParticipatingGroup)
+{
+	re::Regex regex(R"((a)|(b))");
+	std::string input = "b";
+	re::Match match;
+	ASSERT_TRUE(regex.find(input, match));
+	ASSERT_EQ(match.size(), 3);
+	ASSERT_FALSE(match.matched(1));
+	ASSERT_EQ(match.start(1), std::string::npos);
+	ASSERT_TRUE(match.matched(2));
+	ASSERT_EQ(match.group(2), "b");
+}
+
+TEST(TestCase_Regex_find_all, Words)
+{
+	re::Regex regex(R"((\w)\w*)");
+	std::string input = "alpha, beta; gamma";
+	std::vector<std::string_view> words, first_letters;
+	for (const auto& match : regex.find_all(input))
+	{
+		words.push_back(match.group());
+		first_letters.push_back(match.group(1));
+	}
+
+	ASSERT_EQ(words, std::vector<std::string_view>({"alpha", "beta", "gamma"}));
+	ASSERT_EQ(first_letters, std::vector<std::string_view>({"a", "b", "g"}));
+}
+
+TEST(TestCase_Regex_find_all, EmptyMatches)
+{
+	re::Regex regex("x*");
+	std::vector<std::pair<size_t, size_t>> actual;
+	for (const auto& match : regex.find_all("axxb"))
+	{
+		actual.emplace_back(match.start(), match.end());
+	}
+
+	std::vector<std::pair<size_t, size_t>> expected{{0, 0}, {1, 3}, {3, 3}, {4, 4}};
+	ASSERT_EQ(actual, expected);
+}
+
+TEST(TestCase_Regex_find_all, NotFound)
+{
+	re::Regex regex("[0-9]+");
+	auto range = regex.find_all("none");
+	ASSERT_EQ(range.begin(), range.end());
+}
+
+TEST(TestCase_Regex_find_all, IteratorEquality)
+{
+	re::Regex regex("[0-9]+");
+	std::string first = "1 2", second = "1 2";
+	auto range = regex.find_all(first);
+	ASSERT_EQ(range.begin(), range.begin());
+	ASSERT_NE(range.begin(), regex.find_all(second).begin());
+	ASSERT_NE(range.begin(), re::Regex("[0-9]").find_all(first).begin());
+
+	auto it = range.begin();
+	++it;
+	++it;
+	ASSERT_EQ(it, range.end());
+}
+
 TEST(TestCase_escape, left_squared_bracket)
 {
 	auto expr = R"(\[)";
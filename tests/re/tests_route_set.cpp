@@ -0,0 +1,177 @@
+/**
+ * re/tests_route_set.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../src/re/route_set.h"
+#include "../../src/re/arg_regex.h"
+
+using namespace xw;
+
+
+class TestCase_RouteSet : public ::testing::Test
+{
+protected:
+	re::RouteSet routes;
+
+	void SetUp() override
+	{
+		this->routes.add(R"(accounts/<id>(\d+)/picture/<name>(\w+\.jpeg))");
+		this->routes.add(R"(accounts/<id>(\d+)/?)");
+		this->routes.add(R"(accounts/<slug>([-\w]+)/)");
+		this->routes.add(R"(accounts/me/)");
+		this->routes.add(R"(files/<path>(.+))");
+		this->routes.add(R"(items/<uuid>([0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12})/)");
+		this->routes.add(R"(^articles/<year>([0-9]+)-<month>([0-9]+)/$)");
+	}
+};
+
+TEST_F(TestCase_RouteSet, match_CustomRegexArgument)
+{
+	re::RouteSet::Match match;
+	ASSERT_TRUE(this->routes.match("accounts/1/picture/flower.jpeg", match));
+	ASSERT_EQ(match.index, 0);
+	ASSERT_EQ(match.args.size(), 2);
+	ASSERT_EQ(match.arg("id"), "1");
+	ASSERT_EQ(match.arg("name"), "flower.jpeg");
+	ASSERT_EQ(match.arg("age", "none"), "none");
+}
+
+TEST_F(TestCase_RouteSet, match_FallbackRegexRoute)
+{
+	re::RouteSet::Match match;
+	ASSERT_TRUE(this->routes.match("accounts/12", match));
+	ASSERT_EQ(match.index, 1);
+	ASSERT_EQ(match.arg("id"), "12");
+}
+
+TEST(TestCase_RouteSet_Fallback, match_KeepsEscapesOfEarlierLiterals)
+{
+	re::RouteSet routes;
+	routes.add(R"(a\.b/<id>(\d+)/x?)");
+
+	re::RouteSet::Match match;
+	ASSERT_FALSE(routes.match("aXb/1/x", match));
+	ASSERT_TRUE(routes.match("a.b/1/x", match));
+	ASSERT_EQ(match.arg("id"), "1");
+	ASSERT_TRUE(routes.match("a.b/1/", match));
+}
+
+TEST(TestCase_RouteSet_Fallback, match_LongPathWithTwoCustomArguments)
+{
+	re::RouteSet routes;
+	routes.add(R"(files/<dir>([a-z]+)/<name>([a-z]+\.txt))");
+	routes.add(R"(files/<path>(.+))");
+
+	auto dir = std::string(5000, 'd');
+	auto name = std::string(5000, 'n');
+
+	auto path = "files/" + dir + "/" + name + ".txt";
+	re::RouteSet::Match match;
+	ASSERT_TRUE(routes.match(path, match));
+	ASSERT_EQ(match.index, 0);
+	ASSERT_EQ(match.arg("dir"), dir);
+	ASSERT_EQ(match.arg("name"), name + ".txt");
+
+	path = "files/" + dir + "/" + name + ".csv";
+	ASSERT_TRUE(routes.match(path, match));
+	ASSERT_EQ(match.index, 1);
+	ASSERT_EQ(match.arg("path"), path.substr(6));
+}
+
+TEST_F(TestCase_RouteSet, match_FirstAddedWins)
+{
+	re::RouteSet::Match match;
+	ASSERT_TRUE(this->routes.match("accounts/12/", match));
+	ASSERT_EQ(match.index, 1);
+
+	ASSERT_TRUE(this->routes.match("accounts/me/", match));
+	ASSERT_EQ(match.index, 2);
+	ASSERT_EQ(match.arg("slug"), "me");
+}
+
+TEST_F(TestCase_RouteSet, match_Path)
+{
+	re::RouteSet::Match match;
+	ASSERT_TRUE(this->routes.match("files/css/main.css", match));
+	ASSERT_EQ(match.index, 4);
+	ASSERT_EQ(match.arg("path"), "css/main.css");
+}
+
+TEST_F(TestCase_RouteSet, match_Uuid)
+{
+	re::RouteSet::Match match;
+	ASSERT_TRUE(this->routes.match("items/123e4567-e89b-12d3-a456-426614174000/", match));
+	ASSERT_EQ(match.index, 5);
+	ASSERT_EQ(match.arg("uuid"), "123e4567-e89b-12d3-a456-426614174000");
+	ASSERT_FALSE(this->routes.match("items/123e4567-e89b-12d3-a456-42661417400/", match));
+}
+
+TEST_F(TestCase_RouteSet, match_AnchorsAndSeveralArguments)
+{
+	re::RouteSet::Match match;
+	ASSERT_TRUE(this->routes.match("articles/2021-05/", match));
+	ASSERT_EQ(match.index, 6);
+	ASSERT_EQ(match.arg("year"), "2021");
+	ASSERT_EQ(match.arg("month"), "05");
+}
+
+TEST_F(TestCase_RouteSet, match_NotFound)
+{
+	re::RouteSet::Match match;
+	ASSERT_FALSE(this->routes.match("accounts/-1/picture/flower.jpeg", match));
+	ASSERT_EQ(match.index, std::string::npos);
+	ASSERT_TRUE(match.args.empty());
+	ASSERT_FALSE(this->routes.match("", match));
+}
+
+TEST(TestCase_RouteSet_Differential, match_SameAsArgRegex)
+{
+	const std::vector<std::string> patterns = {
+		R"(<a>(\d+)<b>(\d+)/)",
+		R"(users/<name>(\w+)/posts/<id>(\d+)/)",
+		R"(users/<name>([-\w]+)/)",
+		R"(static/<path>(.+))",
+		R"(users/<name>([^/]+)/<rest>(.+))",
+		R"(v<version>(\d+)/<name>([a-z]+)\.json)"
+	};
+	const std::vector<std::string> paths = {
+		"1234/", "users/john/posts/12/", "users/john-doe/", "static/a/b.css",
+		"users/john/x/y", "v2/items.json", "v2/items.xml", "users//", "12a/"
+	};
+
+	re::RouteSet routes;
+	for (const auto& pattern : patterns)
+	{
+		routes.add(pattern);
+	}
+
+	for (const auto& path : paths)
+	{
+		re::RouteSet::Match match;
+		bool found = routes.match(path, match);
+		bool expected_found = false;
+		for (size_t i = 0; i < patterns.size(); i++)
+		{
+			re::ArgRegex regex(patterns[i]);
+			if (regex.match(path))
+			{
+				expected_found = true;
+				ASSERT_TRUE(found) << path;
+				ASSERT_EQ(match.index, i) << path;
+				ASSERT_TRUE(regex.search(path));
+				for (const auto& [key, value] : regex.args())
+				{
+					ASSERT_EQ(match.arg(key), value) << path;
+				}
+
+				break;
+			}
+		}
+
+		ASSERT_EQ(found, expected_found) << path;
+	}
+}
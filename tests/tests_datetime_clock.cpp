@@ -0,0 +1,80 @@
+/**
+ * tests_datetime_clock.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "../src/datetime_clock.h"
+
+using namespace xw;
+
+
+TEST(TestCase_clock, MonotonicIsNonDecreasing)
+{
+	auto previous = dt::now_monotonic_ns();
+	for (size_t i = 0; i < 10000; i++)
+	{
+		auto current = dt::now_monotonic_ns();
+		ASSERT_GE(current, previous);
+		previous = current;
+	}
+
+	previous = dt::now_monotonic_coarse_ns();
+	for (size_t i = 0; i < 10000; i++)
+	{
+		auto current = dt::now_monotonic_coarse_ns();
+		ASSERT_GE(current, previous);
+		previous = current;
+	}
+}
+
+TEST(TestCase_clock, MonotonicMeasuresSleep)
+{
+	auto start = dt::now_monotonic_ns();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	auto elapsed = dt::now_monotonic_ns() - start;
+	ASSERT_GE(elapsed, 20000000);
+	ASSERT_LT(elapsed, 2000000000);
+}
+
+TEST(TestCase_clock, CoarseIsCloseToRealtime)
+{
+	auto realtime = dt::now_realtime_ns() / 1000;
+	auto coarse = dt::now_coarse();
+	ASSERT_FALSE(coarse.is_naive());
+	ASSERT_LT(std::abs(coarse.microseconds() - realtime), 100000);
+
+	auto system = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::system_clock::now().time_since_epoch()
+	).count();
+	ASSERT_LT(std::abs(system - realtime), 100000);
+}
+
+TEST(TestCase_clock, TimedeltaFromNs)
+{
+	ASSERT_EQ(dt::timedelta_from_ns(0), dt::Timedelta(0));
+	ASSERT_EQ(dt::timedelta_from_ns(1999), dt::Timedelta(0, 0, 1));
+	ASSERT_EQ(dt::timedelta_from_ns(90061000001000LL), dt::Timedelta(1, 3661, 1));
+	ASSERT_EQ(dt::timedelta_from_ns(-1500000000), -dt::Timedelta(0, 1, 500000));
+}
+
+TEST(TestCase_CycleClock, MatchesMonotonic)
+{
+	ASSERT_GT(dt::CycleClock::frequency(), 0.0);
+
+	auto start_ns = dt::now_monotonic_ns();
+	auto start_ticks = dt::CycleClock::now();
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	auto ticks = dt::CycleClock::now() - start_ticks;
+	auto elapsed_ns = dt::now_monotonic_ns() - start_ns;
+
+	auto measured = dt::CycleClock::to_nanoseconds(ticks);
+	ASSERT_GT(measured, elapsed_ns * 3 / 4);
+	ASSERT_LT(measured, elapsed_ns * 5 / 4);
+	ASSERT_EQ(dt::CycleClock::to_timedelta(ticks), dt::timedelta_from_ns(measured));
+}
@@ -0,0 +1,155 @@
+/**
+ * tests_datetime_compact.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../src/datetime_compact.h"
+
+using namespace xw;
+
+
+TEST(TestCase_CompactDatetime, DefaultIsNaiveEpoch)
+{
+	dt::CompactDatetime value;
+	ASSERT_TRUE(value.is_naive());
+	ASSERT_EQ(value.microseconds(), 0);
+	ASSERT_EQ(value.utc_offset(), 0);
+	ASSERT_EQ(value.iso_format(), "1970-01-01T00:00:00");
+}
+
+TEST(TestCase_CompactDatetime, FromDatetimeUtc)
+{
+	auto datetime = dt::Datetime(
+		2021, 3, 15, 10, 20, 30, 123456, std::make_shared<dt::Timezone>(dt::Timezone::UTC)
+	);
+	auto value = dt::CompactDatetime::from_datetime(datetime);
+	ASSERT_FALSE(value.is_naive());
+	ASSERT_EQ(value.microseconds(), (int64_t)datetime.timestamp() * 1000000 + 123456);
+	ASSERT_EQ(value.iso_format(), datetime.iso_format());
+}
+
+TEST(TestCase_CompactDatetime, FromDatetimeWithOffset)
+{
+	auto tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, -(5 * 3600 + 30 * 60)));
+	auto datetime = dt::Datetime(1969, 12, 31, 20, 0, 0, 5, tz);
+	auto value = dt::CompactDatetime::from_datetime(datetime);
+	ASSERT_EQ(value.utc_offset(), -(5 * 3600 + 30 * 60));
+	ASSERT_EQ(value.microseconds(), 5400LL * 1000000 + 5);
+	ASSERT_EQ(value.iso_format(), "1969-12-31T20:00:00.000005-05:30");
+
+	auto converted = value.to_datetime();
+	ASSERT_EQ(converted, datetime);
+	ASSERT_EQ(converted.iso_format(), datetime.iso_format());
+}
+
+TEST(TestCase_CompactDatetime, OffsetWithMicrosecondsThrows)
+{
+	auto tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, 3600, 1));
+	auto datetime = dt::Datetime(2021, 1, 1, 0, 0, 0, 0, tz);
+	ASSERT_THROW(dt::CompactDatetime::from_datetime(datetime), std::invalid_argument);
+}
+
+TEST(TestCase_CompactDatetime, NaiveRoundTrip)
+{
+	auto datetime = dt::Datetime(1, 1, 1, 0, 0, 0, 0);
+	auto value = dt::CompactDatetime::from_datetime(datetime);
+	ASSERT_TRUE(value.is_naive());
+	ASSERT_EQ(value.to_datetime(), datetime);
+	ASSERT_EQ(value.to_datetime().tz_info(), nullptr);
+
+	datetime = dt::Datetime(9999, 12, 31, 23, 59, 59, 999999);
+	value = dt::CompactDatetime::from_datetime(datetime);
+	ASSERT_EQ(value.to_datetime(), datetime);
+	ASSERT_EQ(value.iso_format(' '), datetime.iso_format(' '));
+}
+
+TEST(TestCase_CompactDatetime, RandomRoundTrip)
+{
+	std::mt19937 engine(38);
+	std::uniform_int_distribution<int64_t> instants(
+		dt::CompactDatetime::from_datetime(dt::Datetime(1, 1, 2)).microseconds(),
+		dt::CompactDatetime::from_datetime(dt::Datetime(9999, 12, 30)).microseconds()
+	);
+	std::uniform_int_distribution<int32_t> offsets(-86399, 86399);
+	for (size_t i = 0; i < 2000; i++)
+	{
+		auto value = dt::CompactDatetime(instants(engine), i % 4 ? offsets(engine) : dt::CompactDatetime::NAIVE);
+		auto datetime = value.to_datetime();
+		ASSERT_EQ(dt::CompactDatetime::from_datetime(datetime), value);
+		ASSERT_EQ(value.iso_format(), datetime.iso_format());
+
+		dt::CompactDatetime parsed;
+		ASSERT_TRUE(dt::CompactDatetime::parse_iso(value.iso_format(), parsed));
+		ASSERT_EQ(parsed, value);
+	}
+}
+
+TEST(TestCase_CompactDatetime, OrderingIsByInstant)
+{
+	auto utc = std::make_shared<dt::Timezone>(dt::Timezone::UTC);
+	auto plus_two = std::make_shared<dt::Timezone>(dt::Timedelta(0, 7200));
+
+	// Same instant, different offsets.
+	auto a = dt::CompactDatetime::from_datetime(dt::Datetime(2021, 6, 1, 12, 0, 0, 0, utc));
+	auto b = dt::CompactDatetime::from_datetime(dt::Datetime(2021, 6, 1, 14, 0, 0, 0, plus_two));
+	ASSERT_EQ(a - b, 0);
+	ASSERT_NE(a, b);
+	ASSERT_EQ(a, b.with_utc_offset(0));
+	ASSERT_TRUE(a < b);
+
+	// Later wall time, earlier instant.
+	auto c = dt::CompactDatetime::from_datetime(dt::Datetime(2021, 6, 1, 13, 0, 0, 0, plus_two));
+	ASSERT_TRUE(c < a);
+	ASSERT_TRUE(a > c);
+	ASSERT_TRUE(c <= a);
+	ASSERT_TRUE(a >= c);
+	ASSERT_EQ(a - c, 3600LL * 1000000);
+	ASSERT_EQ(c + 3600LL * 1000000, a.with_utc_offset(7200));
+	ASSERT_EQ(a - 3600LL * 1000000, c.with_utc_offset(0));
+}
+
+TEST(TestCase_CompactDatetime, SortSameAsDatetime)
+{
+	std::mt19937 engine(1038);
+	std::uniform_int_distribution<int64_t> instants(0, 4102444800LL * 1000000);
+	std::uniform_int_distribution<int32_t> offsets(-12, 14);
+	std::vector<dt::CompactDatetime> values;
+	for (size_t i = 0; i < 1000; i++)
+	{
+		values.emplace_back(instants(engine), offsets(engine) * 3600);
+	}
+
+	std::sort(values.begin(), values.end());
+	for (size_t i = 1; i < values.size(); i++)
+	{
+		ASSERT_LE(values[i - 1].to_datetime(), values[i].to_datetime());
+	}
+}
+
+TEST(TestCase_CompactDatetime, ParseIsoInvalid)
+{
+	dt::CompactDatetime result;
+	ASSERT_FALSE(dt::CompactDatetime::parse_iso("2021-01-0", result));
+	ASSERT_FALSE(dt::CompactDatetime::parse_iso("2021-01-01T10:00+01:00:00.5", result));
+	ASSERT_TRUE(dt::CompactDatetime::parse_iso("2021-01-01T10:00Z", result));
+	ASSERT_EQ(result.utc_offset(), 0);
+	ASSERT_FALSE(result.is_naive());
+}
+
+TEST(TestCase_CompactDatetime, UtcNow)
+{
+	auto before = dt::CompactDatetime::from_datetime(
+		dt::Datetime::now(std::make_shared<dt::Timezone>(dt::Timezone::UTC))
+	);
+	auto now = dt::CompactDatetime::utc_now();
+	ASSERT_FALSE(now.is_naive());
+	ASSERT_GE(now - before, 0);
+	ASSERT_LT(now - before, 60LL * 1000000);
+}
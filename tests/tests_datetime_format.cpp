@@ -0,0 +1,292 @@
+/**
+ * tests_datetime_format.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <ctime>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "../src/datetime_format.h"
+
+using namespace xw;
+
+
+static std::string _c_strftime(const dt::Datetime& datetime, const std::string& format)
+{
+	auto date = datetime.date();
+	struct tm t{};
+	t.tm_year = datetime.year() - 1900;
+	t.tm_mon = datetime.month() - 1;
+	t.tm_mday = datetime.day();
+	t.tm_hour = datetime.hour();
+	t.tm_min = datetime.minute();
+	t.tm_sec = datetime.second();
+	t.tm_wday = (date.weekday() + 1) % 7;
+	t.tm_yday = (int)(date.to_ordinal() - dt::Date(date.year(), 1, 1).to_ordinal());
+	char buffer[512];
+	auto size = std::strftime(buffer, sizeof(buffer), format.c_str(), &t);
+	return {buffer, size};
+}
+
+TEST(TestCase_Formatter, SameAsCStrftime)
+{
+	std::vector<std::string> formats = {
+		"%a %A %b %h %B %c %C %d %D %e %F",
+		"%g %G %H %I %j %k %l %m %M %n %p %P",
+		"%r %R %S %t %T %u %U %V %w %W %x %X %y %Y %%",
+		"%-d %_d %0e %-H %_m %0k %-j %_y %0Y %_Y %-Y %0C %_G",
+		"%Ey %Od %EY %q %4Y %_4Y %05d %3C %10A %_10b %8p %",
+		"text without directives"
+	};
+	std::vector<dt::Formatter> formatters(formats.begin(), formats.end());
+	std::minstd_rand random(7);
+	for (size_t i = 0; i < 5000; i++)
+	{
+		auto date = dt::Date::from_ordinal(1 + random() % (dt::_MAX_ORDINAL - 1));
+		dt::Datetime datetime(
+			date.year(), date.month(), date.day(), random() % 24, random() % 60, random() % 60
+		);
+		for (size_t j = 0; j < formats.size(); j++)
+		{
+			ASSERT_EQ(formatters[j].format(datetime), _c_strftime(datetime, formats[j]))
+				<< formats[j] << " @ " << datetime.str();
+		}
+	}
+}
+
+TEST(TestCase_Formatter, SameAsStrftime)
+{
+	dt::Datetime datetime(2021, 5, 10, 13, 7, 2, 4512, std::make_shared<dt::Timezone>(
+		dt::Timedelta(0, 0, 0, 0, -330), "IST"
+	));
+	for (const auto& format : {"%F %T.%f %z %Z", "%c", "[%Z|%Z]", "%z%%z"})
+	{
+		ASSERT_EQ(dt::Formatter(format).format(datetime), datetime.strftime(format)) << format;
+	}
+}
+
+TEST(TestCase_Formatter, UtcOffset)
+{
+	dt::Formatter formatter("%z");
+	ASSERT_EQ(formatter.format(dt::Datetime(2021, 1, 1)), "");
+
+	auto tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, 3600 * 5 + 60 * 30 + 15, 12));
+	ASSERT_EQ(formatter.format(dt::Datetime(2021, 1, 1, 0, 0, 0, 0, tz)), "+053015.000012");
+
+	tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, -3600 * 8));
+	ASSERT_EQ(formatter.format(dt::Datetime(2021, 1, 1, 0, 0, 0, 0, tz)), "-0800");
+	ASSERT_EQ(formatter.format(dt::Time(0, 0, 0, 0, tz)), "-0800");
+}
+
+TEST(TestCase_Formatter, DateAndTime)
+{
+	ASSERT_EQ(dt::Formatter("%Y-%m-%d %H:%M:%S.%f %A").format(dt::Date(2021, 12, 31)), "2021-12-31 00:00:00.000000 Friday");
+	ASSERT_EQ(dt::Formatter("%F %T.%f %a %j").format(dt::Time(23, 59, 1, 17)), "1900-01-01 23:59:01.000017 Mon 001");
+}
+
+TEST(TestCase_Formatter, IsoWeek)
+{
+	dt::Formatter formatter("%G-W%V-%u");
+	for (size_t ordinal = dt::Date(1999, 1, 1).to_ordinal(); ordinal < dt::Date(2031, 1, 1).to_ordinal(); ordinal++)
+	{
+		auto date = dt::Date::from_ordinal(ordinal);
+		auto [year, week, day] = date.iso_calendar();
+		char expected[16];
+		std::snprintf(expected, sizeof(expected), "%d-W%02d-%d", year, week, day);
+		ASSERT_EQ(formatter.format(date), expected) << date.str();
+	}
+}
+
+TEST(TestCase_Formatter, format_to)
+{
+	dt::Formatter formatter("%d %B %Y");
+	dt::Date date(2021, 9, 30);
+	char buffer[64];
+	auto size = formatter.format_to(buffer, sizeof(buffer), date);
+	ASSERT_EQ(std::string(buffer, size), "30 September 2021");
+
+	char small[8] = "1234567";
+	ASSERT_EQ(formatter.format_to(small, sizeof(small), date), 17);
+	ASSERT_STREQ(small, "1234567");
+
+	char exact[17];
+	ASSERT_EQ(formatter.format_to(exact, sizeof(exact), date), 17);
+	ASSERT_EQ(std::string(exact, 17), "30 September 2021");
+}
+
+TEST(TestCase_Formatter, ParsedFields)
+{
+	dt::DatetimeFields fields;
+	ASSERT_TRUE(dt::parse_iso_datetime("2021-05-06T07:08:09+01:30", fields));
+	ASSERT_EQ(dt::Formatter("%F %T %z").format(fields), "2021-05-06 07:08:09 +0130");
+	ASSERT_EQ(dt::Formatter("%H %Z").format({fields, "CET"}), "07 CET");
+}
+
+TEST(TestCase_Formatter, program_MergesLiterals)
+{
+	dt::Formatter formatter("at %%%n%Y");
+	ASSERT_EQ(formatter.program().size(), 2);
+	ASSERT_EQ(formatter.program()[0].op, dt::Formatter::Op::Literal);
+	ASSERT_EQ(formatter.program()[1].op, dt::Formatter::Op::Year);
+}
+
+TEST(TestCase_format_iso, Date)
+{
+	char buffer[dt::ISO_DATE_SIZE];
+	ASSERT_EQ(std::string(buffer, dt::format_iso_date(buffer, dt::Date(2021, 3, 7))), "2021-03-07");
+	ASSERT_EQ(std::string(buffer, dt::format_iso_date(buffer, dt::Date(33, 12, 1))), "0033-12-01");
+}
+
+TEST(TestCase_format_iso, Time)
+{
+	char buffer[dt::ISO_TIME_MAX_SIZE];
+	auto tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, -(3600 * 3 + 60 * 30 + 5), -7));
+	std::vector<std::pair<std::string, std::string>> cases = {
+		{std::string(buffer, dt::format_iso_time(buffer, dt::Time(4, 5, 6))), "04:05:06"},
+		{std::string(buffer, dt::format_iso_time(buffer, dt::Time(4, 5, 6, 7))), "04:05:06.000007"},
+		{std::string(buffer, dt::format_iso_time(buffer, dt::Time(4, 5, 6, 7), dt::HOURS)), "04"},
+		{std::string(buffer, dt::format_iso_time(buffer, dt::Time(4, 5, 6, 7), dt::MINUTES)), "04:05"},
+		{std::string(buffer, dt::format_iso_time(buffer, dt::Time(4, 5, 6, 7890), dt::MILLISECONDS)), "04:05:06.007"},
+		{std::string(buffer, dt::format_iso_time(buffer, dt::Time(4, 5, 6, 0), dt::MICROSECONDS)), "04:05:06.000000"},
+		{std::string(buffer, dt::format_iso_time(buffer, dt::Time(23, 59, 59, 999999, tz))), "23:59:59.999999-03:30:05.000007"}
+	};
+	for (const auto& [actual, expected] : cases)
+	{
+		ASSERT_EQ(actual, expected);
+	}
+}
+
+TEST(TestCase_format_iso, Datetime)
+{
+	char buffer[dt::ISO_DATETIME_MAX_SIZE];
+	auto tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, 0, 0, 0, 0, 2));
+	dt::Datetime datetime(2021, 10, 31, 1, 2, 3, 0, tz);
+	ASSERT_EQ(std::string(buffer, dt::format_iso_datetime(buffer, datetime)), "2021-10-31T01:02:03+02:00");
+	ASSERT_EQ(std::string(buffer, dt::format_iso_datetime(buffer, datetime, ' ', dt::MINUTES)), "2021-10-31 01:02+02:00");
+	ASSERT_EQ(datetime.iso_format(), "2021-10-31T01:02:03+02:00");
+	ASSERT_EQ(dt::Datetime(2021, 1, 2, 3, 4, 5, 6).str(), "2021-01-02 03:04:05.000006");
+}
+
+TEST(TestCase_format_imf_fixdate, Datetime)
+{
+	char buffer[dt::IMF_FIXDATE_SIZE];
+	auto size = dt::format_imf_fixdate(buffer, dt::Datetime(1994, 11, 6, 8, 49, 37));
+	ASSERT_EQ(std::string(buffer, size), "Sun, 06 Nov 1994 08:49:37 GMT");
+
+	// Converted to UTC, crossing the year boundary.
+	auto tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, 0, 0, 0, 30, 5));
+	size = dt::format_imf_fixdate(buffer, dt::Datetime(2022, 1, 1, 3, 0, 0, 0, tz));
+	ASSERT_EQ(std::string(buffer, size), "Fri, 31 Dec 2021 21:30:00 GMT");
+
+	// Microseconds of the offset borrow a second.
+	tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, 0, 1));
+	size = dt::format_imf_fixdate(buffer, dt::Datetime(2021, 1, 1, 0, 0, 0, 0, tz));
+	ASSERT_EQ(std::string(buffer, size), "Thu, 31 Dec 2020 23:59:59 GMT");
+}
+
+TEST(TestCase_format_imf_fixdate, TimestampSameAsStrftime)
+{
+	char buffer[dt::IMF_FIXDATE_SIZE];
+	std::minstd_rand random(3);
+	for (size_t i = 0; i < 10000; i++)
+	{
+		time_t timestamp = (time_t)(random() % 253402300799LL) - (i % 2 ? 0 : 62135596800LL);
+		struct tm t{};
+		gmtime_r(&timestamp, &t);
+		char expected[64];
+		auto expected_size = std::strftime(expected, sizeof(expected), "%a, %d %b %Y %H:%M:%S GMT", &t);
+		if (t.tm_year + 1900 < 1000)
+		{
+			continue;
+		}
+
+		auto size = dt::format_imf_fixdate(buffer, timestamp);
+		ASSERT_EQ(std::string(buffer, size), std::string(expected, expected_size)) << timestamp;
+
+		dt::DatetimeFields fields;
+		ASSERT_TRUE(dt::parse_imf_fixdate(std::string_view(buffer, size), fields));
+		ASSERT_EQ(fields.year, t.tm_year + 1900);
+		ASSERT_EQ(fields.month, t.tm_mon + 1);
+		ASSERT_EQ(fields.day, t.tm_mday);
+		ASSERT_EQ(fields.hour, t.tm_hour);
+		ASSERT_EQ(fields.minute, t.tm_min);
+		ASSERT_EQ(fields.second, t.tm_sec);
+	}
+}
+
+TEST(TestCase_parse_imf_fixdate, Invalid)
+{
+	dt::DatetimeFields fields;
+	for (const auto& s : {
+		"Sun, 06 Nov 1994 08:49:37 UTC", "Sun 06 Nov 1994 08:49:37 GMT", "Xyz, 06 Nov 1994 08:49:37 GMT",
+		"Sun, 06 Abc 1994 08:49:37 GMT", "Sun, 0x Nov 1994 08:49:37 GMT", "Sun, 06 Nov 1994 08:49:37 GMT ",
+		"Sunday, 06-Nov-94 08:49:37 GMT", ""
+	})
+	{
+		ASSERT_FALSE(dt::parse_imf_fixdate(s, fields)) << s;
+	}
+}
+
+TEST(TestCase_parse_iso, datetime)
+{
+	dt::DatetimeFields fields;
+	ASSERT_TRUE(dt::parse_iso_datetime("2021-05-06T07:08:09.123-01:30", fields));
+	ASSERT_EQ(fields.year, 2021);
+	ASSERT_EQ(fields.month, 5);
+	ASSERT_EQ(fields.day, 6);
+	ASSERT_EQ(fields.hour, 7);
+	ASSERT_EQ(fields.minute, 8);
+	ASSERT_EQ(fields.second, 9);
+	ASSERT_EQ(fields.microsecond, 123000);
+	ASSERT_TRUE(fields.has_utc_offset);
+	ASSERT_EQ(fields.utc_offset_seconds, -5400);
+
+	ASSERT_TRUE(dt::parse_iso_datetime("2021-05-06 07:08:09.000001Z", fields));
+	ASSERT_EQ(fields.microsecond, 1);
+	ASSERT_TRUE(fields.has_utc_offset);
+	ASSERT_EQ(fields.utc_offset_seconds, 0);
+
+	ASSERT_TRUE(dt::parse_iso_datetime("2021-05-06", fields));
+	ASSERT_EQ(fields.hour, 0);
+	ASSERT_FALSE(fields.has_utc_offset);
+
+	ASSERT_TRUE(dt::parse_iso_datetime("2021-05-06T07", fields));
+	ASSERT_EQ(fields.hour, 7);
+	ASSERT_TRUE(dt::parse_iso_time("10:11:12+05:06:07.000008", fields));
+	ASSERT_EQ(fields.utc_offset_seconds, 5 * 3600 + 6 * 60 + 7);
+	ASSERT_EQ(fields.utc_offset_microseconds, 8);
+}
+
+TEST(TestCase_parse_iso, Invalid)
+{
+	dt::DatetimeFields fields;
+	for (const auto& s : {
+		"2021-5-06", "2021/05/06", "2021-05-06T7", "2021-05-06T07:8", "2021-05-06T07:08:09.12",
+		"2021-05-06T07:08.123", "2021-05-06T07:08:09+1", "2021-05-06T07:08:09Z1", "2021-05-06T07-08",
+		"20x1-05-06", "2021-05-06T07:08:09.1234567"
+	})
+	{
+		ASSERT_FALSE(dt::parse_iso_datetime(s, fields)) << s;
+	}
+}
+
+TEST(TestCase_parse_iso, RoundTrip)
+{
+	auto tz = std::make_shared<dt::Timezone>(dt::Timedelta(0, -3600 * 11 - 45 * 60));
+	for (const auto& datetime : {
+		dt::Datetime(1, 1, 1), dt::Datetime(9999, 12, 31, 23, 59, 59, 999999),
+		dt::Datetime(2021, 7, 8, 9, 10, 11, 12000, tz)
+	})
+	{
+		auto parsed = dt::Datetime::from_iso_format(datetime.iso_format());
+		ASSERT_EQ(parsed.iso_format(), datetime.iso_format());
+	}
+
+	ASSERT_EQ(dt::Date::from_iso_format("2020-02-29"), dt::Date(2020, 2, 29));
+	ASSERT_EQ(dt::Time::from_iso_format("01:02:03.000004").iso_format(), "01:02:03.000004");
+	ASSERT_THROW(dt::Date::from_iso_format("2020-02-2"), std::invalid_argument);
+	ASSERT_THROW(dt::Datetime::from_iso_format("2020-02-29 1"), std::invalid_argument);
+}
@@ -0,0 +1,278 @@
+/**
+ * tests_datetime_zoneinfo.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <random>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "../src/datetime_zoneinfo.h"
+
+using namespace xw;
+
+
+static bool _has_zoneinfo()
+{
+	return (bool)std::ifstream("/usr/share/zoneinfo/America/New_York");
+}
+
+// Version 2 TZif without transitions, with one type and the footer.
+static std::string _make_tzif(const std::string& footer)
+{
+	std::string header("TZif2", 5);
+	header.append(15, '\0');
+	auto counts = [](uint32_t type, uint32_t chars) {
+		std::string result(16, '\0');
+		for (auto value : {type, chars})
+		{
+			for (int shift = 24; shift >= 0; shift -= 8)
+			{
+				result.push_back((char)(value >> shift));
+			}
+		}
+
+		return result;
+	};
+
+	// Type: offset 0, not DST, abbreviation at 0.
+	std::string block("\0\0\0\0\0\0" "UTC\0", 10);
+	return header + counts(1, 4) + block + header + counts(1, 4) + block + "\n" + footer + "\n";
+}
+
+TEST(TestCase_ZoneInfo, SameAsLocaltime)
+{
+	if (!_has_zoneinfo())
+	{
+		GTEST_SKIP();
+	}
+
+	auto old_tz = std::getenv("TZ");
+	std::string saved = old_tz ? old_tz : "";
+	std::mt19937 engine(39);
+	std::uniform_int_distribution<int64_t> timestamps(0, 4102444800LL);
+	for (auto key : {
+		"America/New_York", "Europe/Dublin", "Australia/Sydney", "Asia/Kolkata",
+		"America/Sao_Paulo", "Pacific/Apia", "Europe/London", "UTC"
+	})
+	{
+		auto zone = dt::ZoneInfo::get(key);
+		setenv("TZ", key, 1);
+		tzset();
+		for (size_t i = 0; i < 5000; i++)
+		{
+			time_t timestamp = timestamps(engine);
+			struct tm local{};
+			localtime_r(&timestamp, &local);
+			auto& type = zone->find_utc(timestamp);
+			ASSERT_EQ(type.utc_offset, local.tm_gmtoff) << key << " " << timestamp;
+			ASSERT_EQ(type.abbreviation, local.tm_zone) << key << " " << timestamp;
+			ASSERT_EQ(type.is_dst, local.tm_isdst > 0) << key << " " << timestamp;
+		}
+	}
+
+	if (old_tz)
+	{
+		setenv("TZ", saved.c_str(), 1);
+	}
+	else
+	{
+		unsetenv("TZ");
+	}
+
+	tzset();
+}
+
+TEST(TestCase_ZoneInfo, Transitions)
+{
+	if (!_has_zoneinfo())
+	{
+		GTEST_SKIP();
+	}
+
+	auto zone = dt::ZoneInfo::get("America/New_York");
+
+	// 2021-03-14 07:00 UTC, clocks go from 02:00 EST to 03:00 EDT.
+	int64_t spring = 1615705200;
+	ASSERT_EQ(zone->find_utc(spring - 1).abbreviation, "EST");
+	ASSERT_EQ(zone->find_utc(spring).abbreviation, "EDT");
+	ASSERT_EQ(zone->find_utc(spring).dst_offset, 3600);
+	ASSERT_EQ(zone->find_utc(spring - 1).dst_offset, 0);
+
+	// Local 02:30 is skipped.
+	int64_t local = spring - 5 * 3600 + 1800;
+	ASSERT_EQ(zone->find_local(local, false).utc_offset, -5 * 3600);
+	ASSERT_EQ(zone->find_local(local, true).utc_offset, -4 * 3600);
+
+	// 2021-11-07 06:00 UTC, clocks go from 02:00 EDT to 01:00 EST.
+	int64_t fall = 1636264800;
+	local = fall - 4 * 3600 - 1800;
+	ASSERT_EQ(zone->find_local(local, false).utc_offset, -4 * 3600);
+	ASSERT_EQ(zone->find_local(local, true).utc_offset, -5 * 3600);
+
+	// Far future goes through the footer rule.
+	int64_t future_summer = 4246790400;
+	ASSERT_EQ(zone->find_utc(future_summer).abbreviation, "EDT");
+	ASSERT_EQ(zone->find_utc(future_summer + 183 * 86400).abbreviation, "EST");
+}
+
+TEST(TestCase_ZoneInfo, LocalRoundTrip)
+{
+	if (!_has_zoneinfo())
+	{
+		GTEST_SKIP();
+	}
+
+	std::mt19937 engine(1039);
+	std::uniform_int_distribution<int64_t> timestamps(-2208988800LL, 4102444800LL);
+	for (auto key : {"America/New_York", "Europe/Dublin", "Australia/Lord_Howe", "Asia/Tehran"})
+	{
+		auto zone = dt::ZoneInfo::get(key);
+		for (size_t i = 0; i < 5000; i++)
+		{
+			auto timestamp = timestamps(engine);
+			auto offset = zone->find_utc(timestamp).utc_offset;
+			auto first = zone->find_local(timestamp + offset, false).utc_offset;
+			auto second = zone->find_local(timestamp + offset, true).utc_offset;
+			ASSERT_TRUE(first == offset || second == offset) << key << " " << timestamp;
+		}
+	}
+}
+
+TEST(TestCase_ZoneInfo, CompactDatetime)
+{
+	if (!_has_zoneinfo())
+	{
+		GTEST_SKIP();
+	}
+
+	auto zone = dt::ZoneInfo::get("Europe/London");
+	auto value = dt::CompactDatetime(1625140800LL * 1000000, 0);
+	auto local = zone->to_local(value);
+	ASSERT_EQ(local - value, 0);
+	ASSERT_EQ(local.iso_format(), "2021-07-01T13:00:00+01:00");
+
+	dt::DatetimeFields fields;
+	fields.year = 2021;
+	fields.month = 12;
+	fields.day = 1;
+	fields.hour = 9;
+	ASSERT_EQ(zone->localize(fields).iso_format(), "2021-12-01T09:00:00+00:00");
+	fields.month = 6;
+	ASSERT_EQ(zone->localize(fields).iso_format(), "2021-06-01T09:00:00+01:00");
+}
+
+TEST(TestCase_ZoneInfo, Cache)
+{
+	if (!_has_zoneinfo())
+	{
+		GTEST_SKIP();
+	}
+
+	auto zone = dt::ZoneInfo::get("Europe/Paris");
+	auto size = dt::ZoneInfo::cache_size();
+	ASSERT_EQ(dt::ZoneInfo::get("Europe/Paris"), zone);
+	ASSERT_EQ(dt::ZoneInfo::cache_size(), size);
+
+	std::vector<std::thread> threads;
+	std::vector<std::shared_ptr<const dt::ZoneInfo>> results(8);
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		threads.emplace_back([&results, i]() { results[i] = dt::ZoneInfo::get("Asia/Tokyo"); });
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (auto& result : results)
+	{
+		ASSERT_EQ(result, results[0]);
+	}
+}
+
+TEST(TestCase_ZoneInfo, InvalidKeys)
+{
+	ASSERT_THROW(dt::ZoneInfo::get(""), std::invalid_argument);
+	ASSERT_THROW(dt::ZoneInfo::get("/etc/passwd"), std::invalid_argument);
+	ASSERT_THROW(dt::ZoneInfo::get("../../etc/passwd"), std::invalid_argument);
+	ASSERT_THROW(dt::ZoneInfo::get("Europe//Paris"), std::invalid_argument);
+	ASSERT_THROW(dt::ZoneInfo::get("No/Such_Zone"), std::invalid_argument);
+}
+
+TEST(TestCase_ZoneInfo, InvalidData)
+{
+	ASSERT_THROW(dt::ZoneInfo::from_tzif("x", ""), std::invalid_argument);
+	ASSERT_THROW(dt::ZoneInfo::from_tzif("x", "TZif2"), std::invalid_argument);
+	auto data = _make_tzif("EST5EDT,M3.2.0,M11.1.0");
+	ASSERT_THROW(dt::ZoneInfo::from_tzif("x", data.substr(0, data.size() - 1)), std::invalid_argument);
+	ASSERT_THROW(dt::ZoneInfo::from_tzif("x", _make_tzif("EST5EDT,M13.2.0,M11.1.0")), std::invalid_argument);
+	ASSERT_THROW(dt::ZoneInfo::from_posix_tz("5"), std::invalid_argument);
+}
+
+TEST(TestCase_ZoneInfo, FooterOnly)
+{
+	auto zone = dt::ZoneInfo::from_tzif("x", _make_tzif("EST5EDT,M3.2.0,M11.1.0"));
+	ASSERT_TRUE(zone->transitions().empty());
+
+	// 2021-03-14 07:00 UTC and 2021-11-07 06:00 UTC.
+	ASSERT_EQ(zone->find_utc(1615705199).abbreviation, "EST");
+	ASSERT_EQ(zone->find_utc(1615705200).abbreviation, "EDT");
+	ASSERT_EQ(zone->find_utc(1615705200).utc_offset, -4 * 3600);
+	ASSERT_EQ(zone->find_utc(1636264799).abbreviation, "EDT");
+	ASSERT_EQ(zone->find_utc(1636264800).abbreviation, "EST");
+
+	// Southern hemisphere, DST spans new year.
+	zone = dt::ZoneInfo::from_posix_tz("<+1030>-10:30<+11>-11,M10.1.0,M4.1.0");
+	ASSERT_EQ(zone->find_utc(1609459200).abbreviation, "+11");
+	ASSERT_EQ(zone->find_utc(1609459200).dst_offset, 1800);
+	ASSERT_EQ(zone->find_utc(1625097600).abbreviation, "+1030");
+	ASSERT_EQ(zone->find_utc(1625097600).utc_offset, 37800);
+
+	zone = dt::ZoneInfo::from_posix_tz("JST-9");
+	ASSERT_EQ(zone->find_utc(0).utc_offset, 9 * 3600);
+	ASSERT_EQ(zone->find_local(0).abbreviation, "JST");
+}
+
+TEST(TestCase_ZoneTimezone, Datetime)
+{
+	if (!_has_zoneinfo())
+	{
+		GTEST_SKIP();
+	}
+
+	auto tz = std::make_shared<dt::ZoneTimezone>("America/New_York");
+	auto utc = std::make_shared<dt::Timezone>(dt::Timezone::UTC);
+
+	auto summer = dt::Datetime(2021, 7, 1, 12, 0, 0, 0, tz);
+	ASSERT_EQ(*summer.utc_offset(), dt::Timedelta(0, -4 * 3600));
+	ASSERT_EQ(*summer.dst(), dt::Timedelta(0, 3600));
+	ASSERT_EQ(summer.tz_name(), "EDT");
+	ASSERT_EQ(summer.iso_format(), "2021-07-01T12:00:00-04:00");
+
+	auto winter = dt::Datetime(2021, 1, 1, 12, 0, 0, 0, tz);
+	ASSERT_EQ(*winter.utc_offset(), dt::Timedelta(0, -5 * 3600));
+	ASSERT_EQ(*winter.dst(), dt::Timedelta(0));
+	ASSERT_EQ(winter.tz_name(), "EST");
+
+	// Conversions in both directions, including repeated local time.
+	auto converted = dt::Datetime(2021, 11, 7, 6, 30, 0, 0, utc).as_timezone(tz);
+	ASSERT_EQ(converted.iso_format(), "2021-11-07T01:30:00-05:00");
+	ASSERT_EQ(converted.fold(), 1);
+	converted = dt::Datetime(2021, 11, 7, 5, 30, 0, 0, utc).as_timezone(tz);
+	ASSERT_EQ(converted.iso_format(), "2021-11-07T01:30:00-04:00");
+	ASSERT_EQ(converted.fold(), 0);
+	ASSERT_EQ(summer.as_timezone(utc).iso_format(), "2021-07-01T16:00:00+00:00");
+
+	ASSERT_EQ(*tz, dt::ZoneTimezone("America/New_York"));
+	ASSERT_NE(*tz, dt::ZoneTimezone("Europe/London"));
+	ASSERT_NE(*tz, dt::Timezone::UTC);
+	ASSERT_NE(dt::Timezone::UTC, *tz);
+	ASSERT_EQ(tz->str(), "America/New_York");
+}
@@ -4,6 +4,9 @@
  * Copyright (c) 2019, 2021 Yuriy Lisovskiy
  */
 
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "../src/encoding.h"
@@ -79,6 +82,57 @@ TEST(TestCase_encoding, quote_Safe)
 	ASSERT_EQ(expected, actual);
 }
 
+TEST(TestCase_encoding, quote_LongUnreservedRuns)
+{
+	std::string input = "abcdefghijklmnopqrstuvwxyz/ABCDEFGHIJKLMNOPQRSTUVWXYZ-0123456789_.!~*'() ?";
+	std::string expected = "abcdefghijklmnopqrstuvwxyz%2FABCDEFGHIJKLMNOPQRSTUVWXYZ-0123456789_.!~*'()%20%3F";
+	auto actual = encoding::quote(input);
+	ASSERT_EQ(expected, actual);
+}
+
+TEST(TestCase_encoding, quote_MatchesEscapeChar)
+{
+	std::string input;
+	for (int i = 0; i < 256; i++)
+	{
+		input += (char)i;
+		input += "0123456789abcdef";
+	}
+
+	std::ostringstream ss;
+	for (auto c : input)
+	{
+		encoding::escape_char(ss, c, "/:");
+	}
+
+	ASSERT_EQ(ss.str(), encoding::quote(input, "/:"));
+}
+
+TEST(TestCase_encoding, quote_into_Appends)
+{
+	std::string actual = "/path?next=";
+	encoding::quote_into(actual, "/a b/", "/");
+	ASSERT_EQ("/path?next=/a%20b/", actual);
+}
+
+TEST(TestCase_encoding, unquote)
+{
+	ASSERT_EQ("Š /a", encoding::unquote("%C5%A0%20%2fa"));
+}
+
+TEST(TestCase_encoding, unquote_MalformedSequencesAreKept)
+{
+	ASSERT_EQ("100%", encoding::unquote("100%"));
+	ASSERT_EQ("%2", encoding::unquote("%2"));
+	ASSERT_EQ("%zz!", encoding::unquote("%zz%21"));
+}
+
+TEST(TestCase_encoding, unquote_RoundTrip)
+{
+	std::string input = "key=value & other/path?x=\xc5\xa0";
+	ASSERT_EQ(input, encoding::unquote(encoding::quote(input)));
+}
+
 TEST(TestCase_encoding, encode_ascii_StrictMode)
 {
 	std::string expected;
@@ -225,3 +279,243 @@ TEST(TestCase_encoding, encode_iso_8859_1_ReplaceModeZeroChar)
 	auto actual = encoding::encode_iso_8859_1("\0", encoding::Mode::Replace);
 	ASSERT_EQ("", actual);
 }
+
+TEST(TestCase_encoding, percent_hex_unescape)
+{
+	ASSERT_EQ("abc", encoding::percent_hex_unescape("abc"));
+	ASSERT_EQ("a b/c\xc5\xa0", encoding::percent_hex_unescape("a%20b%2Fc%C5%a0"));
+}
+
+TEST(TestCase_encoding, percent_hex_unescape_ThrowsValueError)
+{
+	ASSERT_THROW(encoding::percent_hex_unescape("a%2"), ValueError);
+	ASSERT_THROW(encoding::percent_hex_unescape("%20%zz"), ValueError);
+}
+
+TEST(TestCase_encoding, percent_decode_in_place)
+{
+	std::string s = "a+b%20c%3D";
+	auto size = encoding::percent_decode_in_place(s.data(), s.size(), true);
+	ASSERT_EQ("a b c=", s.substr(0, size));
+
+	s = "a+b";
+	size = encoding::percent_decode_in_place(s.data(), s.size());
+	ASSERT_EQ("a+b", s.substr(0, size));
+}
+
+TEST(TestCase_encoding, percent_decode_in_place_Malformed)
+{
+	std::string s = "abc%4";
+	ASSERT_EQ(std::string::npos, encoding::percent_decode_in_place(s.data(), s.size()));
+}
+
+TEST(TestCase_encoding, parse_query)
+{
+	std::string query = "a=1&b=hello+world&a=%32&empty=&flag&&bad=%zz&c%3Dd=x%26y";
+	collections::Multimap<std::string_view, std::string_view> result;
+	encoding::parse_query(query, result);
+
+	ASSERT_EQ(5, result.size());
+	auto a = result.get_sequence("a");
+	ASSERT_EQ(2, a.size());
+	ASSERT_EQ("1", a[0]);
+	ASSERT_EQ("2", a[1]);
+	ASSERT_EQ("hello world", result.get("b"));
+	ASSERT_TRUE(result.contains("empty"));
+	ASSERT_EQ("", result.get("empty"));
+	ASSERT_TRUE(result.contains("flag"));
+	ASSERT_FALSE(result.contains("bad"));
+	ASSERT_EQ("x&y", result.get("c=d"));
+}
+
+TEST(TestCase_encoding, encode_iso_8859_1_InvalidUtf8)
+{
+	ASSERT_EQ("ab", encoding::encode_iso_8859_1("a\xff" "b", encoding::Mode::Ignore));
+	ASSERT_EQ("a?b?", encoding::encode_iso_8859_1("a\xff" "b\xc5\xbd", encoding::Mode::Replace));
+	ASSERT_THROW(encoding::encode_iso_8859_1("a\xc3", encoding::Mode::Strict), EncodingError);
+}
+
+TEST(TestCase_encoding, Encoder_ChunkBoundaries)
+{
+	std::string input = "Caf\xc3\xa9 \xc5\xbd \xf0\x9f\x98\x80 \xc2\xa1" "end";
+	for (auto mode : {encoding::Mode::Ignore, encoding::Mode::Replace})
+	{
+		auto expected = encoding::encode_iso_8859_1(input, mode);
+		for (size_t chunk_size = 1; chunk_size <= 4; chunk_size++)
+		{
+			encoding::Encoder encoder(encoding::Encoding::Latin_1, mode);
+			std::string actual;
+			for (size_t i = 0; i < input.size(); i += chunk_size)
+			{
+				encoder.convert(std::string_view(input).substr(i, chunk_size), actual);
+			}
+
+			encoder.convert("", actual, true);
+			ASSERT_EQ(expected, actual);
+		}
+	}
+}
+
+TEST(TestCase_encoding, Encoder_StrictThrowsOnTruncatedInput)
+{
+	encoding::Encoder encoder(encoding::Encoding::Latin_1);
+	std::string out;
+	encoder.convert("ab\xc3", out);
+	ASSERT_EQ("ab", out);
+	ASSERT_THROW(encoder.convert("", out, true), EncodingError);
+}
+
+TEST(TestCase_encoding, Decoder_Latin1)
+{
+	encoding::Decoder decoder(encoding::Encoding::Latin_1);
+	std::string out;
+	decoder.convert("Caf\xe9", out, true);
+	ASSERT_EQ("Caf\xc3\xa9", out);
+}
+
+TEST(TestCase_encoding, Decoder_Utf8ChunkBoundaries)
+{
+	std::string input = "a\xe2\x82\xac\xff" "b\xf0\x9f\x98";
+	std::string expected = "a\xe2\x82\xac\xef\xbf\xbd" "b\xef\xbf\xbd";
+	for (size_t chunk_size = 1; chunk_size <= 4; chunk_size++)
+	{
+		encoding::Decoder decoder(encoding::Encoding::Utf_8, encoding::Mode::Replace);
+		std::string actual;
+		for (size_t i = 0; i < input.size(); i += chunk_size)
+		{
+			decoder.convert(std::string_view(input).substr(i, chunk_size), actual);
+		}
+
+		decoder.convert("", actual, true);
+		ASSERT_EQ(expected, actual);
+	}
+}
+
+class StringReader : public io::IReader
+{
+public:
+	std::string data;
+	size_t pos = 0;
+
+	ssize_t read_line(std::string& buffer) override
+	{
+		auto end = this->data.find('\n', this->pos);
+		end = end == std::string::npos ? this->data.size() : end + 1;
+		buffer = this->data.substr(this->pos, end - this->pos);
+		this->pos = end;
+		return (ssize_t)buffer.size();
+	}
+
+	ssize_t read(std::string& buffer, size_t max_count) override
+	{
+		buffer = this->data.substr(this->pos, max_count);
+		this->pos += buffer.size();
+		return (ssize_t)buffer.size();
+	}
+
+	bool close_reader() override
+	{
+		return true;
+	}
+};
+
+class StringWriter : public io::IWriter
+{
+public:
+	std::string data;
+	bool closed = false;
+
+	ssize_t write(const char* buffer, size_t count) override
+	{
+		this->data.append(buffer, count);
+		return (ssize_t)count;
+	}
+
+	bool close_writer() override
+	{
+		this->closed = true;
+		return true;
+	}
+};
+
+TEST(TestCase_encoding, TranscodingReader_read)
+{
+	auto source = std::make_shared<StringReader>();
+	source->data = "\xc5\xbd\xc3\xa9";
+	encoding::TranscodingReader reader(
+		source, std::make_unique<encoding::Encoder>(encoding::Encoding::Latin_1, encoding::Mode::Replace)
+	);
+	std::string result, buffer;
+	while (reader.read(buffer, 3) > 0)
+	{
+		result += buffer;
+	}
+
+	result += buffer;
+	ASSERT_EQ("?\xe9", result);
+}
+
+// Returns the given results in order and writes to the buffer only
+// if the result is positive.
+class UntouchedBufferReader : public io::IReader
+{
+public:
+	std::vector<std::pair<ssize_t, std::string>> results;
+	size_t pos = 0;
+
+	ssize_t read_line(std::string& buffer) override
+	{
+		return this->read(buffer, 0);
+	}
+
+	ssize_t read(std::string& buffer, size_t) override
+	{
+		const auto& [result, data] = this->results[this->pos++];
+		if (result > 0)
+		{
+			buffer = data;
+		}
+
+		return result;
+	}
+
+	bool close_reader() override
+	{
+		return true;
+	}
+};
+
+TEST(TestCase_encoding, TranscodingReader_read_DoesNotReconvertUntouchedBuffer)
+{
+	auto source = std::make_shared<UntouchedBufferReader>();
+	source->results = {{4, "Caf\xc3"}, {-1, ""}, {1, "\xa9"}, {0, ""}, {0, ""}};
+	encoding::TranscodingReader reader(
+		source, std::make_unique<encoding::Encoder>(encoding::Encoding::Latin_1, encoding::Mode::Replace)
+	);
+	std::string buffer = "stale";
+	ASSERT_EQ(4, reader.read(buffer, 4));
+	ASSERT_EQ("Caf", buffer);
+
+	buffer = "stale";
+	ASSERT_EQ(-1, reader.read(buffer, 4));
+	ASSERT_EQ("", buffer);
+
+	ASSERT_EQ(1, reader.read(buffer, 4));
+	ASSERT_EQ("\xe9", buffer);
+
+	ASSERT_EQ(0, reader.read(buffer, 4));
+	ASSERT_EQ("", buffer);
+
+	ASSERT_EQ(0, reader.read_line(buffer));
+	ASSERT_EQ("", buffer);
+}
+
+TEST(TestCase_encoding, TranscodingWriter_write)
+{
+	auto target = std::make_shared<StringWriter>();
+	encoding::TranscodingWriter writer(target, std::make_unique<encoding::Decoder>(encoding::Encoding::Latin_1));
+	ASSERT_EQ(4, writer.write("Caf\xe9", 4));
+	ASSERT_TRUE(writer.close_writer());
+	ASSERT_TRUE(target->closed);
+	ASSERT_EQ("Caf\xc3\xa9", target->data);
+}
@@ -4,6 +4,9 @@
  * Copyright (c) 2021 Yuriy Lisovskiy
  */
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "../src/lazy.h"
@@ -25,3 +28,92 @@ TEST(TestCase_Lazy, value_Set)
 	lazy.set(7);
 	ASSERT_EQ(lazy.get(), 7);
 }
+
+struct TestCase_Lazy_NoDefault
+{
+	int value;
+
+	explicit TestCase_Lazy_NoDefault(int v) : value(v)
+	{
+	}
+};
+
+TEST(TestCase_ConcurrentLazy, InitializesOnce)
+{
+	std::atomic<int> calls = 0;
+	ConcurrentLazy<TestCase_Lazy_NoDefault> lazy([&calls]()
+	{
+		calls++;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		return TestCase_Lazy_NoDefault(42);
+	});
+	ASSERT_FALSE(lazy.is_loaded());
+
+	std::vector<std::thread> threads;
+	std::vector<const TestCase_Lazy_NoDefault*> results(8);
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		threads.emplace_back([&lazy, &results, i]() { results[i] = &lazy.get(); });
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	ASSERT_EQ(calls, 1);
+	ASSERT_TRUE(lazy.is_loaded());
+	for (auto result : results)
+	{
+		ASSERT_EQ(result, &lazy.get());
+		ASSERT_EQ(result->value, 42);
+	}
+}
+
+TEST(TestCase_ConcurrentLazy, RetriesAfterException)
+{
+	int calls = 0;
+	ConcurrentLazy<int> lazy([&calls]() -> int
+	{
+		if (calls++ == 0)
+		{
+			throw std::logic_error("failed");
+		}
+
+		return 7;
+	});
+	ASSERT_THROW(lazy.get(), std::logic_error);
+	ASSERT_FALSE(lazy.is_loaded());
+	ASSERT_EQ(lazy.get(), 7);
+	ASSERT_EQ(calls, 2);
+}
+
+TEST(TestCase_ConcurrentLazy, NullInitializer)
+{
+	ASSERT_THROW(ConcurrentLazy<int>(nullptr), std::runtime_error);
+}
+
+TEST(TestCase_AsyncLazy, get)
+{
+	auto caller = std::this_thread::get_id();
+	AsyncLazy<std::thread::id> lazy([]() { return std::this_thread::get_id(); });
+	auto future = lazy.future();
+	ASSERT_NE(lazy.get(), caller);
+	ASSERT_TRUE(lazy.is_ready());
+	ASSERT_EQ(future.get(), lazy.get());
+}
+
+TEST(TestCase_AsyncLazy, Deferred)
+{
+	auto caller = std::this_thread::get_id();
+	AsyncLazy<std::thread::id> lazy([]() { return std::this_thread::get_id(); }, std::launch::deferred);
+	ASSERT_FALSE(lazy.is_ready());
+	ASSERT_EQ(lazy.get(), caller);
+}
+
+TEST(TestCase_AsyncLazy, Exception)
+{
+	AsyncLazy<int> lazy([]() -> int { throw std::logic_error("failed"); });
+	ASSERT_THROW(lazy.get(), std::logic_error);
+	ASSERT_THROW(AsyncLazy<int>(nullptr), std::runtime_error);
+}
@@ -58,3 +58,64 @@ TEST_F(OptionsTestCase, GetStringTestReturnsDefault)
 {
 	ASSERT_EQ(this->options.get<std::string>("account", "default value"), "default value");
 }
+
+TEST_F(OptionsTestCase, GetOutOfRangeReturnsDefault)
+{
+	this->options.set("big", "99999999999");
+	ASSERT_EQ(this->options.get<int>("big", -1), -1);
+	ASSERT_EQ(this->options.get<long>("big", -1), 99999999999);
+}
+
+class FrozenOptionsTestCase : public ::testing::Test
+{
+protected:
+	Options options;
+	FrozenOptions frozen;
+
+	void SetUp() override
+	{
+		this->options = {{
+			{"user_id", "12345"},
+			{"account_name", "some_name"},
+			{"negative", "-7"},
+			{"big", "99999999999"},
+			{"huge", "18446744073709551615"},
+			{"ratio", " 0.25x"},
+			{"flag", "true"}
+		}};
+		this->frozen = this->options.freeze();
+	}
+};
+
+TEST_F(FrozenOptionsTestCase, contains)
+{
+	ASSERT_EQ(this->frozen.size(), 7);
+	ASSERT_TRUE(this->frozen.contains("user_id"));
+	ASSERT_FALSE(this->frozen.contains("user"));
+	ASSERT_EQ(this->frozen.find("account_name"), "some_name");
+	ASSERT_FALSE(this->frozen.find("account").has_value());
+}
+
+TEST_F(FrozenOptionsTestCase, SameAsOptions)
+{
+	for (auto key : {"user_id", "account_name", "negative", "big", "huge", "ratio", "flag", "missing"})
+	{
+		ASSERT_EQ(this->frozen.get<short>(key, -1), this->options.get<short>(key, -1)) << key;
+		ASSERT_EQ(this->frozen.get<int>(key, -1), this->options.get<int>(key, -1)) << key;
+		ASSERT_EQ(this->frozen.get<unsigned int>(key, 1), this->options.get<unsigned int>(key, 1)) << key;
+		ASSERT_EQ(this->frozen.get<long long>(key, -1), this->options.get<long long>(key, -1)) << key;
+		ASSERT_EQ(this->frozen.get<unsigned long long>(key, 1), this->options.get<unsigned long long>(key, 1)) << key;
+		ASSERT_EQ(this->frozen.get<float>(key, -1), this->options.get<float>(key, -1)) << key;
+		ASSERT_EQ(this->frozen.get<double>(key, -1), this->options.get<double>(key, -1)) << key;
+		ASSERT_EQ(this->frozen.get<long double>(key, -1), this->options.get<long double>(key, -1)) << key;
+		ASSERT_EQ(this->frozen.get<std::string>(key, "-"), this->options.get<std::string>(key, "-")) << key;
+	}
+}
+
+TEST_F(FrozenOptionsTestCase, IsSnapshot)
+{
+	this->options.set("user_id", "1");
+	ASSERT_EQ(this->frozen.get<int>("user_id"), 12345);
+	ASSERT_EQ(this->options.freeze().get<int>("user_id"), 1);
+	ASSERT_STREQ(this->frozen.get<const char*>("account_name"), "some_name");
+}
@@ -573,3 +573,46 @@ TEST(TestCase_string_utils, make_text_list_MultipleItems)
 	auto actual = str::make_text_list({"one", "two", "three", "four"}, "and");
 	ASSERT_EQ(expected, actual);
 }
+
+TEST(TestCase_string_utils, _normalize_exp_PowerOfTen)
+{
+	double input = 1000.0;
+	ASSERT_EQ(str::_normalize_exp(&input), 4);
+	ASSERT_EQ(input, 0.1);
+
+	input = 0.1;
+	ASSERT_EQ(str::_normalize_exp(&input), 0);
+	ASSERT_EQ(input, 0.1);
+}
+
+TEST(TestCase_string_utils, _normalize_exp_Extremes)
+{
+	double input = 1.5e300;
+	ASSERT_EQ(str::_normalize_exp(&input), 301);
+	ASSERT_DOUBLE_EQ(input, 0.15);
+
+	input = 2.5e-310;
+	ASSERT_EQ(str::_normalize_exp(&input), -309);
+	ASSERT_NEAR(input, 0.25, 1e-12);
+
+	input = 0.0;
+	ASSERT_EQ(str::_normalize_exp(&input), 0);
+	ASSERT_EQ(input, 0.0);
+}
+
+TEST(TestCase_string_utils, number_to_string)
+{
+	ASSERT_EQ(str::number_to_string(-42), "-42");
+	ASSERT_EQ(str::number_to_string(18446744073709551615ull), "18446744073709551615");
+	ASSERT_EQ(str::number_to_string(2.0), "2.0");
+	ASSERT_EQ(str::number_to_string(0.1), "0.1");
+	ASSERT_EQ(str::number_to_string(0.1f), "0.1");
+	ASSERT_EQ(str::number_to_string(1.23456789), "1.23456789");
+	ASSERT_EQ(str::number_to_string(1e-7), "0.0000001");
+	ASSERT_EQ(str::number_to_string(1e20), "100000000000000000000.0");
+	ASSERT_EQ(str::number_to_string(std::numeric_limits<double>::infinity()), "inf");
+
+	auto max = str::number_to_string(std::numeric_limits<double>::max());
+	ASSERT_EQ(max.size(), 311);
+	ASSERT_EQ(std::stod(max), std::numeric_limits<double>::max());
+}
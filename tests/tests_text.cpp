@@ -4,8 +4,11 @@
  * Copyright (c) 2021 Yuriy Lisovskiy
  */
 
+#include <random>
+
 #include <gtest/gtest.h>
 
+#include "../src/re/regex.h"
 #include "../src/text.h"
 
 using namespace xw;
@@ -52,3 +55,48 @@ TEST(smart_split, smart_split_NestedDoubleQuotes)
 		ASSERT_EQ(expected[i], actual[i]);
 	}
 }
+
+TEST(smart_split, smart_split_views)
+{
+	std::string input = R"(url 'path/to/page' key="value with spaces")";
+	auto actual = text::smart_split_views(input);
+	std::vector<std::string_view> expected = {"url", "'path/to/page'", R"(key="value with spaces")"};
+	ASSERT_EQ(actual, expected);
+	ASSERT_EQ(actual[0].data(), input.data());
+}
+
+TEST(smart_split, smart_split_UnclosedQuotes)
+{
+	std::string input = "a'b c \"d\"e f \"g";
+	std::vector<std::string_view> expected = {"a'b", "c", "\"d\"e", "f", "\"g"};
+	ASSERT_EQ(text::smart_split_views(input), expected);
+}
+
+TEST(smart_split, smart_split_Empty)
+{
+	ASSERT_TRUE(text::smart_split_views("").empty());
+	ASSERT_TRUE(text::smart_split_views(" \t\r\n").empty());
+}
+
+TEST(smart_split, SmartSplit_SameAsRegex)
+{
+	const std::string alphabet = "ab \t\n\r\v\f\"'\\/=\x80";
+	std::minstd_rand random(42);
+	re::Regex regex(text::SMART_SPLIT_REGEX.str(), re::Engine::Std);
+	for (size_t i = 0; i < 20000; i++)
+	{
+		std::string input(random() % 24, ' ');
+		for (auto& c : input)
+		{
+			c = alphabet[random() % alphabet.size()];
+		}
+
+		std::vector<std::string_view> expected;
+		for (const auto& match : regex.find_all(input))
+		{
+			expected.push_back(match.group());
+		}
+
+		ASSERT_EQ(text::smart_split_views(input), expected) << input;
+	}
+}
@@ -195,3 +195,38 @@ TEST(TestCase_utility, as_std_c_string)
 {
 	ASSERT_EQ(util::as<const char*>("Hello, World"), "Hello, World");
 }
+
+TEST(TestCase_utility, as_SkipsWhitespaceAndIgnoresSuffix)
+{
+	ASSERT_EQ(util::as<int>("  +42px"), 42);
+	ASSERT_EQ(util::as<double>("\t-2.5e1;"), -25.0);
+}
+
+TEST(TestCase_utility, as_Throws)
+{
+	ASSERT_THROW(util::as<int>("abc"), std::invalid_argument);
+	ASSERT_THROW(util::as<int>("+-1"), std::invalid_argument);
+	ASSERT_THROW(util::as<unsigned int>("-1"), std::invalid_argument);
+	ASSERT_THROW(util::as<short int>("40000"), std::out_of_range);
+	ASSERT_THROW(util::as<float>("1e50"), std::out_of_range);
+}
+
+TEST(TestCase_utility, parse_number)
+{
+	long value = 7;
+	ASSERT_EQ(util::parse_number(std::string_view("123", 2), value), std::errc());
+	ASSERT_EQ(value, 12);
+	ASSERT_EQ(util::parse_number("", value), std::errc::invalid_argument);
+	ASSERT_EQ(util::parse_number("99999999999999999999", value), std::errc::result_out_of_range);
+	ASSERT_EQ(value, 12);
+}
+
+TEST(TestCase_utility, try_as)
+{
+	ASSERT_EQ(util::try_as<int>("-15"), -15);
+	ASSERT_EQ(util::try_as<unsigned char>("255"), 255);
+	ASSERT_EQ(util::try_as<double>("0.1"), 0.1);
+	ASSERT_EQ(util::try_as<std::string>("text"), "text");
+	ASSERT_FALSE(util::try_as<int>("text").has_value());
+	ASSERT_FALSE(util::try_as<unsigned char>("256").has_value());
+}
@@ -0,0 +1,130 @@
+/**
+ * types/tests_arena.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../src/types/utility.h"
+
+using namespace xw;
+
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+	size_t allocations = 0;
+
+protected:
+	void* do_allocate(size_t bytes, size_t alignment) override
+	{
+		this->allocations++;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* p, size_t bytes, size_t alignment) override
+	{
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	[[nodiscard]]
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+TEST(TestCase_Arena, make)
+{
+	types::Arena arena;
+	auto value = arena.make<types::int_>(42);
+	ASSERT_EQ(value->get(), 42);
+	ASSERT_EQ(arena.live(), 1);
+
+	auto copy = value;
+	value.reset();
+	ASSERT_EQ(arena.live(), 1);
+	copy.reset();
+	ASSERT_EQ(arena.live(), 0);
+}
+
+TEST(TestCase_Arena, to_object)
+{
+	types::Arena arena;
+	{
+		std::vector<std::shared_ptr<const obj::Object>> values{
+			types::to_object(7, arena),
+			types::to_object(std::string("Hello"), arena),
+			types::to_object(types::string("World"), arena),
+			types::to_object(dt::Date(2021, 1, 2), arena)
+		};
+		ASSERT_EQ(arena.live(), 4);
+		ASSERT_EQ(values[0]->__str__(), "7");
+		ASSERT_EQ(values[1]->__repr__(), "\"Hello\"");
+		ASSERT_EQ(values[2]->__str__(), "World");
+		ASSERT_EQ(values[3]->__str__(), "2021-01-02");
+	}
+
+	ASSERT_EQ(arena.live(), 0);
+}
+
+TEST(TestCase_Arena, UsesUpstreamForBlocksOnly)
+{
+	CountingResource upstream;
+	types::Arena arena(1 << 16, &upstream);
+	std::vector<std::shared_ptr<const obj::Object>> values;
+	for (int i = 0; i < 1000; i++)
+	{
+		values.push_back(types::to_object(i, arena));
+	}
+
+	ASSERT_EQ(upstream.allocations, 1);
+	ASSERT_EQ(values[999]->__str__(), "999");
+}
+
+TEST(TestCase_Arena, release)
+{
+	CountingResource upstream;
+	types::Arena arena(64, &upstream);
+	auto value = arena.make<types::string>("Hello");
+	ASSERT_THROW(arena.release(), RuntimeError);
+
+	value.reset();
+	arena.release();
+	auto allocations = upstream.allocations;
+	value = arena.make<types::string>("World");
+	ASSERT_EQ(upstream.allocations, allocations + 1);
+	ASSERT_EQ(value->get(), "World");
+}
+
+TEST(TestCase_Arena, LastReferencesDroppedInThreads)
+{
+	types::Arena arena;
+	std::vector<std::vector<std::shared_ptr<types::int_>>> parts(4);
+	for (int i = 0; i < 1000; i++)
+	{
+		parts[i % parts.size()].push_back(arena.make<types::int_>(i));
+	}
+
+	ASSERT_EQ(arena.live(), 1000);
+	std::vector<std::thread> threads;
+	for (auto& part : parts)
+	{
+		threads.emplace_back([values = std::move(part)]() mutable
+		{
+			values.clear();
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	ASSERT_EQ(arena.live(), 0);
+	arena.release();
+}
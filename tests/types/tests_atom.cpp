@@ -0,0 +1,131 @@
+/**
+ * types/tests_atom.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../src/types/atom.h"
+#include "../../src/types/string.h"
+#include "../../src/types/fundamental.h"
+
+using namespace xw;
+
+
+TEST(TestCase_Atom, EqualAtomsAreTheSame)
+{
+	types::Atom first(std::string("context_key"));
+	types::Atom second("context_key");
+	ASSERT_EQ(first, second);
+	ASSERT_EQ(first.view().data(), second.view().data());
+	ASSERT_NE(first, types::Atom("other_key"));
+	ASSERT_EQ(first.hash(), std::hash<std::string_view>{}("context_key"));
+	ASSERT_EQ(std::hash<types::Atom>{}(first), std::hash<types::String>{}(types::String("context_key")));
+}
+
+TEST(TestCase_Atom, from_static)
+{
+	static const char value[] = "atom_from_static_storage";
+	auto atom = types::Atom::from_static(value);
+	ASSERT_EQ(atom.view().data(), value);
+	ASSERT_EQ(types::Atom(std::string(value)), atom);
+	ASSERT_EQ(types::Atom::from_static("atom_from_static_storage").view().data(), value);
+}
+
+TEST(TestCase_Atom, Empty)
+{
+	types::Atom atom;
+	ASSERT_EQ(atom, types::Atom(""));
+	ASSERT_FALSE((bool)atom);
+	ASSERT_TRUE(!atom);
+	ASSERT_EQ(atom.size(), 0);
+}
+
+TEST(TestCase_Atom, __str__And__repr__)
+{
+	types::Atom atom("Hello");
+	ASSERT_EQ(atom.__str__(), "Hello");
+	ASSERT_EQ(atom.__repr__(), "\"Hello\"");
+}
+
+TEST(TestCase_Atom, Ordering)
+{
+	types::Atom a("a"), b("b");
+	ASSERT_TRUE(a < b);
+	ASSERT_TRUE(a <= b);
+	ASSERT_TRUE(b > a);
+	ASSERT_TRUE(a >= types::Atom("a"));
+	ASSERT_FALSE(a < types::Atom("a"));
+}
+
+TEST(TestCase_Atom, __cmp__)
+{
+	types::Atom a("a"), b("b");
+	types::String string("b");
+	ASSERT_EQ(a.__cmp__(&b), -1);
+	ASSERT_EQ(b.__cmp__(&a), 1);
+	ASSERT_EQ(b.__cmp__(&string), 0);
+	ASSERT_EQ(string.__cmp__(&a), 1);
+	ASSERT_EQ(string.__cmp__(&b), 0);
+
+	types::int_ number(1);
+	ASSERT_THROW(auto _ = a.__cmp__(&number), TypeError);
+}
+
+TEST(TestCase_Atom, __cmp__SameAsString)
+{
+	const char* values[] = {"", "a", "ab", "b", "ba"};
+	for (auto left : values)
+	{
+		for (auto right : values)
+		{
+			types::String string(left), other_string(right);
+			types::Atom other_atom(right);
+			auto expected = string.__cmp__(&other_string);
+			ASSERT_EQ(expected, std::string_view(left).compare(right) < 0 ? -1 : (left == std::string_view(right) ? 0 : 1));
+			ASSERT_EQ(string.__cmp__(&other_atom), expected) << left << " " << right;
+			ASSERT_EQ(types::Atom(left).__cmp__(&other_string), expected) << left << " " << right;
+		}
+	}
+}
+
+TEST(TestCase_Atom, ConcurrentInterning)
+{
+	std::vector<std::vector<types::Atom>> results(4);
+	std::vector<std::thread> threads;
+	for (auto& result : results)
+	{
+		threads.emplace_back([&result]()
+		{
+			for (int i = 0; i < 1000; i++)
+			{
+				result.emplace_back("concurrent_" + std::to_string(i));
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (size_t i = 0; i < 1000; i++)
+	{
+		for (const auto& result : results)
+		{
+			ASSERT_EQ(result[i], results[0][i]);
+		}
+	}
+
+	ASSERT_GE(types::Atom::table_size(), 1000);
+}
+
+TEST(TestCase_String, FromStringView)
+{
+	std::string_view value("Hello, World", 5);
+	ASSERT_EQ(types::String(value).get(), "Hello");
+}
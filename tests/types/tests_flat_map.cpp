@@ -0,0 +1,137 @@
+/**
+ * types/tests_flat_map.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "../../src/types/flat_map.h"
+#include "../../src/types/map.h"
+#include "../../src/types/string.h"
+#include "../../src/types/fundamental.h"
+
+using namespace xw;
+
+
+class TestCase_FlatMap : public ::testing::Test
+{
+protected:
+	types::FlatMap<types::string, types::fundamental<int>> string_int_map{
+		{"Hello", 10}, {"14.7", 11}, {"Hello", 12}
+	};
+	types::FlatMap<types::fundamental<char>, types::fundamental<float>> empty_map;
+};
+
+TEST_F(TestCase_FlatMap, is_map_True)
+{
+	ASSERT_TRUE(this->string_int_map.is_map());
+	ASSERT_FALSE(this->string_int_map.is_sequence());
+}
+
+TEST_F(TestCase_FlatMap, FirstValueOfRepeatedKeyIsKept)
+{
+	ASSERT_EQ(this->string_int_map.size(), 2);
+	ASSERT_EQ(this->string_int_map.at("Hello").get(), 10);
+}
+
+TEST_F(TestCase_FlatMap, find)
+{
+	ASSERT_EQ(this->string_int_map.find("14.7")->get(), 11);
+	ASSERT_EQ(this->string_int_map.find("World"), nullptr);
+	ASSERT_FALSE(this->string_int_map.contains("A"));
+	ASSERT_THROW(auto _ = this->string_int_map.at("World"), KeyError);
+	ASSERT_EQ(this->empty_map.find('a'), nullptr);
+}
+
+TEST_F(TestCase_FlatMap, insert_erase)
+{
+	ASSERT_TRUE(this->string_int_map.insert("A", 1));
+	ASSERT_FALSE(this->string_int_map.insert("A", 2));
+	ASSERT_FALSE(this->string_int_map.insert_or_assign("A", 3));
+	ASSERT_EQ(this->string_int_map.at("A").get(), 3);
+	ASSERT_EQ(this->string_int_map.begin()->first.get(), "14.7");
+	ASSERT_EQ(this->string_int_map.rbegin()->first.get(), "Hello");
+	ASSERT_TRUE(this->string_int_map.erase("A"));
+	ASSERT_FALSE(this->string_int_map.erase("A"));
+	ASSERT_EQ(this->string_int_map.size(), 2);
+}
+
+TEST_F(TestCase_FlatMap, SameAsMap)
+{
+	types::Map<types::string, types::fundamental<int>> map{{"Hello", 10}, {"14.7", 11}};
+	ASSERT_EQ(this->string_int_map.__str__(), map.__str__());
+	ASSERT_EQ(this->string_int_map.__repr__(), map.__repr__());
+
+	std::vector<std::string> expected, actual;
+	map.look_through([&expected](size_t, const obj::Object* key, const obj::Object*)
+	{
+		expected.push_back(key->__str__());
+	}, true);
+	this->string_int_map.look_through([&actual](size_t, const obj::Object* key, const obj::Object*)
+	{
+		actual.push_back(key->__str__());
+	}, true);
+	ASSERT_EQ(actual, expected);
+}
+
+TEST_F(TestCase_FlatMap, __cmp__)
+{
+	types::flat_map<types::string, types::fundamental<int>> other{{"14.7", 11}, {"Hello", 10}};
+	ASSERT_EQ(this->string_int_map.__cmp__(&other), 0);
+	other.insert_or_assign("Hello", 9);
+	ASSERT_EQ(this->string_int_map.__cmp__(&other), 1);
+	ASSERT_EQ(other.__cmp__(&this->string_int_map), -1);
+	ASSERT_THROW(auto _ = this->string_int_map.__cmp__(&this->empty_map), TypeError);
+}
+
+TEST(TestCase_FlatMap_Random, SameAsStdMap)
+{
+	std::mt19937 engine(1043);
+	std::uniform_int_distribution<int> keys(0, 300);
+	std::uniform_int_distribution<int> actions(0, 9);
+	types::FlatMap<types::int_, types::int_> map;
+	std::map<int, int> expected;
+	for (int i = 0; i < 10000; i++)
+	{
+		auto key = keys(engine);
+		switch (actions(engine))
+		{
+			case 0:
+				ASSERT_EQ(map.erase(key), expected.erase(key) == 1);
+				break;
+			case 1:
+			case 2:
+				ASSERT_EQ(map.insert_or_assign(key, i), !expected.contains(key));
+				expected[key] = i;
+				break;
+			case 3:
+				ASSERT_EQ(map.insert(key, i), expected.emplace(key, i).second);
+				break;
+			default:
+			{
+				auto value = map.find(key);
+				auto it = expected.find(key);
+				ASSERT_EQ(value != nullptr, it != expected.end());
+				if (value)
+				{
+					ASSERT_EQ(value->get(), it->second);
+				}
+
+				break;
+			}
+		}
+	}
+
+	ASSERT_EQ(map.size(), expected.size());
+	auto it = expected.begin();
+	for (const auto& [key, value] : map)
+	{
+		ASSERT_EQ(key.get(), it->first);
+		ASSERT_EQ(value.get(), it->second);
+		it++;
+	}
+}
@@ -0,0 +1,153 @@
+/**
+ * types/tests_hash_map.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "../../src/types/hash_map.h"
+#include "../../src/types/string.h"
+#include "../../src/types/fundamental.h"
+
+using namespace xw;
+
+
+class TestCase_HashMap : public ::testing::Test
+{
+protected:
+	types::HashMap<types::string, types::fundamental<int>> string_int_map;
+	types::HashMap<types::fundamental<char>, types::fundamental<float>> empty_map;
+
+	void SetUp() override
+	{
+		this->string_int_map.insert("Hello", 10);
+		this->string_int_map.insert("14.7", 11);
+	}
+};
+
+TEST_F(TestCase_HashMap, is_map_True)
+{
+	ASSERT_TRUE(this->string_int_map.is_map());
+	ASSERT_FALSE(this->string_int_map.is_sequence());
+}
+
+TEST_F(TestCase_HashMap, find)
+{
+	ASSERT_EQ(this->string_int_map.find("Hello")->get(), 10);
+	ASSERT_EQ(this->string_int_map.at("14.7").get(), 11);
+	ASSERT_EQ(this->string_int_map.find("World"), nullptr);
+	ASSERT_TRUE(this->string_int_map.contains("Hello"));
+	ASSERT_THROW(auto _ = this->string_int_map.at("World"), KeyError);
+	ASSERT_EQ(this->empty_map.find('a'), nullptr);
+}
+
+TEST_F(TestCase_HashMap, insert)
+{
+	ASSERT_FALSE(this->string_int_map.insert("Hello", 1));
+	ASSERT_EQ(this->string_int_map.at("Hello").get(), 10);
+	ASSERT_FALSE(this->string_int_map.insert_or_assign("Hello", 1));
+	ASSERT_EQ(this->string_int_map.at("Hello").get(), 1);
+	ASSERT_TRUE(this->string_int_map.insert_or_assign("World", 2));
+	ASSERT_EQ(this->string_int_map.size(), 3);
+}
+
+TEST_F(TestCase_HashMap, look_through_InsertionOrder)
+{
+	std::vector<std::string> keys;
+	this->string_int_map.look_through([&keys](size_t i, const obj::Object* key, const obj::Object* val)
+	{
+		ASSERT_EQ(i, keys.size());
+		keys.push_back(key->__str__());
+	}, false);
+	ASSERT_EQ(keys, std::vector<std::string>({"Hello", "14.7"}));
+
+	keys.clear();
+	this->string_int_map.look_through([&keys](size_t, const obj::Object* key, const obj::Object*)
+	{
+		keys.push_back(key->__str__());
+	}, true);
+	ASSERT_EQ(keys, std::vector<std::string>({"14.7", "Hello"}));
+}
+
+TEST_F(TestCase_HashMap, empty)
+{
+	ASSERT_TRUE(this->empty_map.empty());
+	ASSERT_FALSE(this->string_int_map.empty());
+	ASSERT_EQ(this->string_int_map.size(), 2);
+}
+
+TEST_F(TestCase_HashMap, __cmp__)
+{
+	types::hash_map<types::string, types::fundamental<int>> other{{"14.7", 11}, {"Hello", 10}};
+	ASSERT_EQ(this->string_int_map.__cmp__(&other), 0);
+
+	other.insert_or_assign("Hello", 9);
+	ASSERT_EQ(this->string_int_map.__cmp__(&other), 1);
+	ASSERT_EQ(other.__cmp__(&this->string_int_map), -1);
+
+	ASSERT_THROW(auto _ = this->string_int_map.__cmp__(&this->empty_map), TypeError);
+}
+
+TEST_F(TestCase_HashMap, __str__)
+{
+	ASSERT_EQ(this->string_int_map.__str__(), R"({{"Hello", 10}, {"14.7", 11}})");
+	ASSERT_EQ(this->string_int_map.__repr__(), R"({{"Hello", 10}, {"14.7", 11}})");
+	ASSERT_EQ(this->empty_map.__str__(), "{}");
+}
+
+TEST(TestCase_HashMap_Random, SameAsStdMap)
+{
+	std::mt19937 engine(43);
+	std::uniform_int_distribution<int> keys(0, 2000);
+	std::uniform_int_distribution<int> actions(0, 9);
+	types::HashMap<types::int_, types::int_> map;
+	std::map<int, int> expected;
+	for (int i = 0; i < 20000; i++)
+	{
+		auto key = keys(engine) * 1024;
+		switch (actions(engine))
+		{
+			case 0:
+				ASSERT_EQ(map.erase(key), expected.erase(key) == 1);
+				break;
+			case 1:
+			case 2:
+				ASSERT_EQ(map.insert_or_assign(key, i), !expected.contains(key));
+				expected[key] = i;
+				break;
+			case 3:
+			case 4:
+				ASSERT_EQ(map.insert(key, i), expected.emplace(key, i).second);
+				break;
+			default:
+			{
+				auto value = map.find(key);
+				auto it = expected.find(key);
+				ASSERT_EQ(value != nullptr, it != expected.end());
+				if (value)
+				{
+					ASSERT_EQ(value->get(), it->second);
+				}
+
+				break;
+			}
+		}
+
+		ASSERT_EQ(map.size(), expected.size());
+	}
+
+	for (const auto& [key, value] : map)
+	{
+		ASSERT_EQ(expected.at(key.get()), value.get());
+	}
+}
+
+TEST(TestCase_hash, StringAndFundamental)
+{
+	ASSERT_EQ(std::hash<types::string>{}(types::string("abc")), std::hash<std::string>{}("abc"));
+	ASSERT_EQ(std::hash<types::int_>{}(types::int_(42)), std::hash<int>{}(42));
+}
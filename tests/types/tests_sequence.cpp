@@ -4,6 +4,8 @@
  * Copyright (c) 2021 Yuriy Lisovskiy
  */
 
+#include <list>
+
 #include <gtest/gtest.h>
 
 #include "../../src/types/sequence.h"
@@ -152,3 +154,87 @@ TEST_F(TestCase_Sequence, __repr__Empty)
 	auto actual = this->empty_sequence.__repr__();
 	ASSERT_EQ(expected, actual);
 }
+
+TEST_F(TestCase_Sequence, objects)
+{
+	auto objects = this->string_sequence.objects();
+	ASSERT_TRUE(objects.has_value());
+	ASSERT_EQ(objects->size(), 2);
+	ASSERT_EQ((*objects)[0].__str__(), "Hello");
+	ASSERT_EQ(&(*objects)[1], &(*this->string_sequence)[1]);
+
+	std::vector<std::string> actual;
+	for (const auto& value : *objects)
+	{
+		actual.push_back(value.__str__());
+	}
+
+	ASSERT_EQ(actual, std::vector<std::string>({"Hello", "14.7"}));
+
+	actual.clear();
+	for (auto it = objects->rbegin(); it != objects->rend(); it++)
+	{
+		actual.push_back(it->__str__());
+	}
+
+	ASSERT_EQ(actual, std::vector<std::string>({"14.7", "Hello"}));
+	ASSERT_EQ(objects->end() - objects->begin(), 2);
+}
+
+TEST_F(TestCase_Sequence, objects_Empty)
+{
+	auto objects = this->empty_sequence.objects();
+	ASSERT_TRUE(objects.has_value());
+	ASSERT_TRUE(objects->empty());
+	ASSERT_EQ(objects->begin(), objects->end());
+}
+
+TEST_F(TestCase_Sequence, for_each)
+{
+	std::vector<std::string> actual;
+	this->string_sequence.for_each([&actual](size_t i, const types::string& value)
+	{
+		ASSERT_EQ(i, actual.size());
+		actual.push_back(value.__str__());
+	});
+	ASSERT_EQ(actual, std::vector<std::string>({"Hello", "14.7"}));
+
+	actual.clear();
+	this->string_sequence.for_each([&actual](size_t, const types::string& value)
+	{
+		actual.push_back(value.__str__());
+	}, true);
+	ASSERT_EQ(actual, std::vector<std::string>({"14.7", "Hello"}));
+}
+
+TEST_F(TestCase_Sequence, iterators)
+{
+	std::vector<std::string> actual;
+	for (const auto& value : this->string_sequence)
+	{
+		actual.push_back(value.__str__());
+	}
+
+	ASSERT_EQ(actual, std::vector<std::string>({"Hello", "14.7"}));
+	ASSERT_EQ(this->string_sequence.rbegin()->__str__(), "14.7");
+}
+
+TEST(TestCase_Sequence_List, look_through)
+{
+	types::Sequence<types::string, std::list<types::string>> sequence{
+		types::string("Hello"), types::string("World")
+	};
+	(*sequence).push_front(types::string("Hi"));
+	ASSERT_FALSE(sequence.objects().has_value());
+
+	std::vector<std::string> actual;
+	sequence.look_through([&actual](size_t, const obj::Object* value)
+	{
+		actual.push_back(value->__str__());
+	}, true);
+	ASSERT_EQ(actual, std::vector<std::string>({"World", "Hello", "Hi"}));
+	ASSERT_EQ(sequence.__str__(), R"({"Hi", "Hello", "World"})");
+
+	types::Sequence<types::string, std::list<types::string>> other{types::string("Hi")};
+	ASSERT_EQ(sequence.__cmp__(&other), 1);
+}
@@ -79,3 +79,38 @@ TEST(TestCase_utility, to_object_Map)
 	};
 	ASSERT_EQ(types::to_object(container).get()->__str__(), R"({{"a", 14}, {"b", -7}, {"c", 0}})");
 }
+
+TEST(TestCase_utility, to_object_MovedVector)
+{
+	auto container = std::vector<types::char_>{'a', 'b'};
+	auto data = container.data();
+	auto object = types::to_object(std::move(container));
+	auto sequence = dynamic_cast<const types::Sequence<types::char_>*>(object.get());
+	ASSERT_NE(sequence, nullptr);
+	ASSERT_EQ(&*sequence->begin(), data);
+}
+
+TEST(TestCase_utility, to_object_view)
+{
+	auto container = std::vector<types::char_>{'a', 'b', 'c'};
+	auto object = types::to_object_view(container);
+	auto sequence = dynamic_cast<const types::SequenceContainer*>(object.get());
+	ASSERT_EQ(&(*sequence->objects())[0], &container[0]);
+	ASSERT_EQ(object->__str__(), "{'a', 'b', 'c'}");
+
+	auto map = std::map<types::string, types::int_>{{"a", 14}};
+	ASSERT_EQ(types::to_object_view(map)->__str__(), R"({{"a", 14}})");
+}
+
+TEST(TestCase_utility, to_object_SharedContainer)
+{
+	auto container = std::make_shared<std::vector<types::int_>>(std::vector<types::int_>{1, 2});
+	auto object = types::to_object(container);
+	ASSERT_EQ(container.use_count(), 2);
+	ASSERT_EQ(object->__str__(), "{1, 2}");
+
+	auto map = std::make_shared<const std::map<types::string, types::int_>>(
+		std::map<types::string, types::int_>{{"a", 1}}
+	);
+	ASSERT_TRUE(dynamic_cast<const types::MapContainer*>(types::to_object(map).get())->is_map());
+}
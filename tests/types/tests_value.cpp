@@ -0,0 +1,188 @@
+/**
+ * types/tests_value.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <cstdint>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "../../src/types/value.h"
+#include "../../src/types/utility.h"
+
+using namespace xw;
+
+
+TEST(TestCase_Value, Kinds)
+{
+	ASSERT_EQ(types::Value().kind(), types::Value::Kind::Null);
+	ASSERT_EQ(types::Value(true).kind(), types::Value::Kind::Bool);
+	ASSERT_EQ(types::Value(7).kind(), types::Value::Kind::Int);
+	ASSERT_EQ(types::Value(7u).kind(), types::Value::Kind::Int);
+	ASSERT_EQ(types::Value(1.5f).kind(), types::Value::Kind::Double);
+	ASSERT_EQ(types::Value("abc").kind(), types::Value::Kind::String);
+	ASSERT_EQ(types::Value(dt::CompactDatetime(0, 0)).kind(), types::Value::Kind::Datetime);
+	ASSERT_EQ(types::Value(types::Value::sequence_type{1, 2}).kind(), types::Value::Kind::Sequence);
+	ASSERT_EQ(types::Value(types::Value::map_type{{"a", 1}}).kind(), types::Value::Kind::Map);
+	ASSERT_EQ(types::Value(1.5).kind_name(), "double");
+}
+
+TEST(TestCase_Value, as)
+{
+	types::Value value(42);
+	ASSERT_TRUE(value.is<int64_t>());
+	ASSERT_EQ(value.as<int64_t>(), 42);
+	ASSERT_THROW(auto _ = value.as<std::string>(), TypeError);
+	ASSERT_THROW(types::Value(std::shared_ptr<const types::Value::sequence_type>()), NullPointerException);
+}
+
+TEST(TestCase_Value, str)
+{
+	ASSERT_EQ(types::Value().str(), "null");
+	ASSERT_EQ(types::Value(false).str(), "false");
+	ASSERT_EQ(types::Value(-12).str(), "-12");
+	ASSERT_EQ(types::Value(2.5).str(), "2.5");
+	ASSERT_EQ(types::Value(2.0).str(), "2.0");
+	ASSERT_EQ(types::Value("abc").str(), "abc");
+	ASSERT_EQ(types::Value("abc").repr(), "\"abc\"");
+	ASSERT_EQ(types::Value(dt::CompactDatetime(1000000, 0)).str(), "1970-01-01 00:00:01+00:00");
+
+	types::Value sequence(types::Value::sequence_type{1, "a", types::Value::sequence_type{}});
+	ASSERT_EQ(sequence.str(), R"({1, "a", {}})");
+
+	types::Value map(types::Value::map_type{{"b", 2.5}, {"a", "x"}});
+	ASSERT_EQ(map.str(), R"({{"a", "x"}, {"b", 2.5}})");
+}
+
+TEST(TestCase_Value, SameStrAsObject)
+{
+	std::vector<types::Value> values{
+		types::Value(), true, 15, 0.25, "text", dt::CompactDatetime(1000000, 3600),
+		types::Value::sequence_type{1, "a"}, types::Value::map_type{{"k", 1.0}}
+	};
+	for (const auto& value : values)
+	{
+		auto object = value.to_object();
+		ASSERT_EQ(object->__str__(), value.str());
+		ASSERT_EQ(object->__repr__(), value.repr());
+		ASSERT_EQ(types::Value::from_object(object.get()), value);
+	}
+}
+
+TEST(TestCase_Value, compare)
+{
+	ASSERT_EQ(types::Value(1).compare(types::Value(1.5)), -1);
+	ASSERT_EQ(types::Value(true).compare(types::Value(1)), 0);
+	ASSERT_EQ(types::Value("b").compare(types::Value("a")), 1);
+	ASSERT_EQ(types::Value().compare(types::Value()), 0);
+	ASSERT_TRUE(types::Value(types::Value::sequence_type{1, 2}) < types::Value(types::Value::sequence_type{1, 3}));
+	ASSERT_TRUE(types::Value(types::Value::sequence_type{1}) < types::Value(types::Value::sequence_type{1, 0}));
+	ASSERT_TRUE(types::Value(types::Value::map_type{{"a", 2}}) > types::Value(types::Value::map_type{{"a", 1}}));
+	ASSERT_THROW(auto _ = types::Value(1).compare(types::Value("1")), TypeError);
+}
+
+TEST(TestCase_Value, Equality)
+{
+	ASSERT_EQ(types::Value(2), types::Value(2.0));
+	ASSERT_NE(types::Value(1), types::Value("1"));
+	ASSERT_NE(types::Value(), types::Value(0));
+	ASSERT_EQ(
+		types::Value(types::Value::sequence_type{1, "a"}),
+		types::Value(types::Value::sequence_type{1.0, "a"})
+	);
+}
+
+TEST(TestCase_Value, Bool)
+{
+	ASSERT_FALSE((bool)types::Value());
+	ASSERT_FALSE((bool)types::Value(0));
+	ASSERT_FALSE((bool)types::Value(""));
+	ASSERT_FALSE((bool)types::Value(types::Value::sequence_type{}));
+	ASSERT_TRUE((bool)types::Value(0.5));
+	ASSERT_TRUE((bool)types::Value(dt::CompactDatetime()));
+	ASSERT_TRUE((bool)types::Value(types::Value::map_type{{"a", types::Value()}}));
+}
+
+TEST(TestCase_Value, from_object)
+{
+	ASSERT_TRUE(types::Value::from_object(nullptr).is_null());
+	ASSERT_EQ(types::Value::from_object(types::to_object('c').get()), types::Value("c"));
+	ASSERT_EQ(types::Value::from_object(types::to_object(7u).get()), types::Value(7));
+	ASSERT_EQ(types::Value::from_object(types::to_object(0.5f).get()), types::Value(0.5));
+
+	types::Atom atom("atom");
+	ASSERT_EQ(types::Value::from_object(&atom), types::Value("atom"));
+
+	auto list = std::list<types::int_>{1, 2};
+	ASSERT_EQ(types::Value::from_object(types::to_object(list).get()), types::Value(types::Value::sequence_type{1, 2}));
+
+	auto map = std::map<types::int_, types::string>{{1, "a"}};
+	ASSERT_EQ(
+		types::Value::from_object(types::to_object(map).get()),
+		types::Value(types::Value::map_type{{"1", "a"}})
+	);
+
+	types::Date date(dt::Date(2021, 3, 4));
+	ASSERT_EQ(types::Value::from_object(&date), types::Value("2021-03-04"));
+}
+
+TEST(TestCase_Value, LargeUnsignedIsDouble)
+{
+	auto max = std::numeric_limits<uint64_t>::max();
+	ASSERT_EQ(types::Value((uint64_t)std::numeric_limits<int64_t>::max()).kind(), types::Value::Kind::Int);
+	ASSERT_EQ(types::Value(max).kind(), types::Value::Kind::Double);
+	ASSERT_EQ(types::Value(max).as<double>(), (double)max);
+
+	auto value = types::Value::from_object(types::to_object((unsigned long long)max).get());
+	ASSERT_EQ(value.kind(), types::Value::Kind::Double);
+	ASSERT_GT(value, types::Value(std::numeric_limits<int64_t>::max()));
+}
+
+TEST(TestCase_Value, Characters)
+{
+	ASSERT_EQ(types::Value('x'), types::Value("x"));
+	ASSERT_EQ(types::Value((signed char)'y'), types::Value("y"));
+	ASSERT_EQ(types::Value((unsigned char)'z'), types::Value("z"));
+	ASSERT_EQ(types::Value(L'x').kind(), types::Value::Kind::Int);
+	ASSERT_EQ(types::Value(u8'x').as<int64_t>(), 120);
+	ASSERT_EQ(types::Value(u'x').as<int64_t>(), 120);
+	ASSERT_EQ(types::Value(U'x').as<int64_t>(), 120);
+}
+
+TEST(TestCase_Value, from_object_Characters)
+{
+	ASSERT_EQ(types::Value::from_object(types::to_object('x').get()), types::Value('x'));
+	ASSERT_EQ(types::Value::from_object(types::to_object((unsigned char)'z').get()), types::Value((unsigned char)'z'));
+	for (const auto& value : {
+		types::Value::from_object(types::to_object(L'x').get()),
+		types::Value::from_object(types::to_object(u8'x').get()),
+		types::Value::from_object(types::to_object(u'x').get()),
+		types::Value::from_object(types::to_object(U'x').get())
+	})
+	{
+		ASSERT_EQ(value.kind(), types::Value::Kind::Int);
+		ASSERT_EQ(value.as<int64_t>(), 120);
+	}
+}
+
+TEST(TestCase_ValueObject, __cmp__)
+{
+	types::ValueObject value(types::Value(5));
+	types::int_ number(6);
+	types::ValueObject other(types::Value(5.0));
+	ASSERT_EQ(value.__cmp__(&number), -1);
+	ASSERT_EQ(value.__cmp__(&other), 0);
+	ASSERT_TRUE(value == other);
+	ASSERT_FALSE(!value);
+}
+
+TEST(TestCase_Value, visit)
+{
+	auto kind = types::Value("abc").visit([](const auto& v) -> int
+	{
+		return std::is_same_v<std::decay_t<decltype(v)>, std::string> ? 1 : 0;
+	});
+	ASSERT_EQ(kind, 1);
+}
@@ -0,0 +1,110 @@
+/**
+ * types/tests_view.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../../src/types/view.h"
+#include "../../src/types/string.h"
+#include "../../src/types/fundamental.h"
+
+using namespace xw;
+
+
+TEST(TestCase_SequenceView, RefersToContainer)
+{
+	std::vector<types::string> container{"one", "two"};
+	types::SequenceView<std::vector<types::string>> view(container);
+	ASSERT_TRUE(view.is_sequence());
+	ASSERT_EQ(&*view, &container);
+
+	container.emplace_back("three");
+	ASSERT_EQ(view.size(), 3);
+	ASSERT_EQ(view.__str__(), R"({"one", "two", "three"})");
+
+	std::vector<std::string> reversed;
+	view.look_through([&reversed](size_t, const obj::Object* value)
+	{
+		reversed.push_back(value->__str__());
+	}, true);
+	ASSERT_EQ(reversed, std::vector<std::string>({"three", "two", "one"}));
+}
+
+TEST(TestCase_SequenceView, objects)
+{
+	std::vector<types::int_> container{1, 2, 3};
+	types::SequenceView<std::vector<types::int_>> view(container);
+	auto objects = view.objects();
+	ASSERT_TRUE(objects.has_value());
+	ASSERT_EQ(objects->size(), 3);
+	ASSERT_EQ(&(*objects)[2], &container[2]);
+
+	std::list<types::int_> list{1, 2, 3};
+	ASSERT_FALSE(types::SequenceView<std::list<types::int_>>(list).objects().has_value());
+}
+
+TEST(TestCase_SequenceView, SharesOwnership)
+{
+	auto container = std::make_shared<std::vector<types::int_>>(std::vector<types::int_>{1, 2});
+	std::weak_ptr<std::vector<types::int_>> weak = container;
+	auto view = std::make_shared<types::SequenceView<std::vector<types::int_>>>(container);
+	container.reset();
+	ASSERT_FALSE(weak.expired());
+	ASSERT_EQ(view->__str__(), "{1, 2}");
+	view.reset();
+	ASSERT_TRUE(weak.expired());
+
+	ASSERT_THROW(
+		types::SequenceView<std::vector<types::int_>>(std::shared_ptr<const std::vector<types::int_>>()),
+		NullPointerException
+	);
+}
+
+TEST(TestCase_SequenceView, __cmp__)
+{
+	std::vector<types::int_> left{1, 2}, right{1, 3};
+	types::SequenceView<std::vector<types::int_>> left_view(left), right_view(right), same(left);
+	ASSERT_EQ(left_view.__cmp__(&same), 0);
+	ASSERT_EQ(left_view.__cmp__(&right_view), -1);
+	ASSERT_EQ(right_view.__cmp__(&left_view), 1);
+
+	types::int_ number(1);
+	ASSERT_THROW(auto _ = left_view.__cmp__(&number), TypeError);
+}
+
+TEST(TestCase_MapView, RefersToContainer)
+{
+	std::map<types::string, types::int_> container{{"b", 2}, {"a", 1}};
+	types::MapView<std::map<types::string, types::int_>> view(container);
+	ASSERT_TRUE(view.is_map());
+	ASSERT_EQ(view.size(), 2);
+	ASSERT_EQ(view.__str__(), R"({{"a", 1}, {"b", 2}})");
+
+	std::vector<std::string> keys;
+	view.look_through([&keys, &container](size_t, const obj::Object* key, const obj::Object* value)
+	{
+		ASSERT_EQ(&container.at(*dynamic_cast<const types::string*>(key)), value);
+		keys.push_back(key->__str__());
+	}, true);
+	ASSERT_EQ(keys, std::vector<std::string>({"b", "a"}));
+}
+
+TEST(TestCase_MapView, UnorderedMap)
+{
+	std::unordered_map<types::string, types::int_> left{{"a", 1}}, right{{"a", 2}};
+	types::MapView<std::unordered_map<types::string, types::int_>> left_view(left), right_view(right), same(left);
+	ASSERT_EQ(left_view.__cmp__(&same), 0);
+	ASSERT_THROW(auto _ = left_view.__cmp__(&right_view), TypeError);
+
+	size_t count = 0;
+	left_view.look_through([&count](size_t, const obj::Object*, const obj::Object*) { count++; }, false);
+	ASSERT_EQ(count, 1);
+	ASSERT_THROW(left_view.look_through([](size_t, const obj::Object*, const obj::Object*) {}, true), TypeError);
+}
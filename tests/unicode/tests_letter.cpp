@@ -0,0 +1,89 @@
+/**
+ * tests_letter.cpp
+ *
+ * Copyright (c) 2021 Yuriy Lisovskiy
+ */
+
+#include <gtest/gtest.h>
+
+#include "../../src/unicode/letter.h"
+#include "../../src/unicode/tables.h"
+#include "../../src/encoding.h"
+
+using namespace xw;
+
+
+// Reference implementation of 'simple_fold' which searches range tables.
+static uint32_t _simple_fold_by_ranges(uint32_t c)
+{
+	if (c < unicode::ASCII_FOLD.size())
+	{
+		return unicode::ASCII_FOLD[c];
+	}
+
+	for (const auto& pair : unicode::CASE_ORBIT)
+	{
+		if (pair.from == c)
+		{
+			return pair.to;
+		}
+	}
+
+	auto [l, _] = unicode::_to(unicode::Case::Lower, c, unicode::CASE_RANGES);
+	if (l != c)
+	{
+		return l;
+	}
+
+	return unicode::_to(unicode::Case::Upper, c, unicode::CASE_RANGES).first;
+}
+
+TEST(TestCase_letter, to_MatchesRangeTables)
+{
+	for (uint32_t c = 0; c <= unicode::MAX_WCHAR_T + 1; c++)
+	{
+		ASSERT_EQ(unicode::to(unicode::Case::Upper, c), unicode::_to(unicode::Case::Upper, c, unicode::CASE_RANGES).first);
+		ASSERT_EQ(unicode::to(unicode::Case::Lower, c), unicode::_to(unicode::Case::Lower, c, unicode::CASE_RANGES).first);
+		ASSERT_EQ(unicode::to(unicode::Case::Title, c), unicode::_to(unicode::Case::Title, c, unicode::CASE_RANGES).first);
+	}
+}
+
+TEST(TestCase_letter, simple_fold_MatchesRangeTables)
+{
+	for (uint32_t c = 0; c <= unicode::MAX_WCHAR_T; c++)
+	{
+		ASSERT_EQ(unicode::simple_fold(c), _simple_fold_by_ranges(c));
+	}
+}
+
+TEST(TestCase_letter, simple_fold)
+{
+	ASSERT_EQ(unicode::simple_fold('A'), 'a');
+	ASSERT_EQ(unicode::simple_fold('a'), 'A');
+	ASSERT_EQ(unicode::simple_fold('K'), 'k');
+	ASSERT_EQ(unicode::simple_fold('k'), 0x212A);
+	ASSERT_EQ(unicode::simple_fold(0x212A), 'K');
+	ASSERT_EQ(unicode::simple_fold('1'), '1');
+	ASSERT_EQ(unicode::simple_fold(0x110000), 0x110000);
+}
+
+TEST(TestCase_letter, to_upper_to_lower)
+{
+	ASSERT_EQ(unicode::to_upper('a'), 'A');
+	ASSERT_EQ(unicode::to_lower('Z'), 'z');
+	ASSERT_EQ(unicode::to_upper(0x0161), 0x0160);
+	ASSERT_EQ(unicode::to_lower(0x0160), 0x0161);
+	ASSERT_EQ(unicode::to_upper(0x1E922), 0x1E900);
+	ASSERT_EQ(unicode::to_upper(0x4E00), 0x4E00);
+}
+
+TEST(TestCase_letter, is_space_MatchesRangeTable)
+{
+	for (uint32_t c = 0; c <= 0xFFFF; c++)
+	{
+		bool expected = encoding::_is16(unicode::WHITE_SPACE.r16, (uint16_t)c);
+		ASSERT_EQ(unicode::is_space(c), expected) << c;
+	}
+
+	ASSERT_FALSE(unicode::is_space(0x10000));
+}
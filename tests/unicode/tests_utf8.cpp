@@ -62,3 +62,144 @@ TEST(TestCase_decode_symbol, success)
 		ASSERT_EQ(size, pair.string.size());
 	}
 }
+
+TEST(TestCase_validate_utf8, success)
+{
+	std::string input = "plain ascii text which is longer than sixteen bytes, ";
+	for (const auto& pair : UTF8_DATA_STRINGS)
+	{
+		input += pair.string;
+	}
+
+	auto result = unicode::utf8::validate_utf8(input);
+	ASSERT_TRUE(result.ok());
+	ASSERT_EQ(result.count, input.size());
+}
+
+TEST(TestCase_validate_utf8, errors)
+{
+	struct test_case
+	{
+		std::string input;
+		unicode::utf8::Error error;
+		size_t position;
+	};
+
+	const test_case cases[] = {
+		{"0123456789abcdef0123\x80", unicode::utf8::Error::Invalid, 20},
+		{"ab\xc0\x80", unicode::utf8::Error::Invalid, 2},     // overlong
+		{"\xed\xa0\x80", unicode::utf8::Error::Invalid, 0},   // surrogate half
+		{"\xf4\x90\x80\x80", unicode::utf8::Error::Invalid, 0}, // above U+10FFFF
+		{"abc\xe2\x82", unicode::utf8::Error::Truncated, 3},
+		{"abc\xf0\x90\x80", unicode::utf8::Error::Truncated, 3},
+		{"\xe2\x28\xa1", unicode::utf8::Error::Invalid, 0}
+	};
+	for (const auto& c : cases)
+	{
+		auto result = unicode::utf8::validate_utf8(c.input);
+		ASSERT_EQ(result.error, c.error);
+		ASSERT_EQ(result.count, c.position);
+	}
+}
+
+TEST(TestCase_utf8_to_latin1, success)
+{
+	std::string input = "Caf\xc3\xa9 \xc2\xa1\xc3\xbf, longer than sixteen bytes";
+	std::string out(input.size(), '\0');
+	auto result = unicode::utf8::utf8_to_latin1(input, out.data());
+	ASSERT_TRUE(result.ok());
+	out.resize(result.count);
+	ASSERT_EQ(out, "Caf\xe9 \xa1\xff, longer than sixteen bytes");
+}
+
+TEST(TestCase_utf8_to_latin1, out_of_range)
+{
+	std::string input = "ab\xc5\xbd";
+	std::string out(input.size(), '\0');
+	auto result = unicode::utf8::utf8_to_latin1(input, out.data());
+	ASSERT_EQ(result.error, unicode::utf8::Error::OutOfRange);
+	ASSERT_EQ(result.count, 2);
+}
+
+TEST(TestCase_latin1_to_utf8, round_trip)
+{
+	std::string input;
+	for (int i = 1; i < 256; i++)
+	{
+		input += (char)i;
+	}
+
+	std::string utf8(input.size() * 2, '\0');
+	auto result = unicode::utf8::latin1_to_utf8(input, utf8.data());
+	ASSERT_TRUE(result.ok());
+	utf8.resize(result.count);
+	ASSERT_TRUE(unicode::utf8::validate_utf8(utf8).ok());
+
+	std::string latin1(utf8.size(), '\0');
+	result = unicode::utf8::utf8_to_latin1(utf8, latin1.data());
+	ASSERT_TRUE(result.ok());
+	latin1.resize(result.count);
+	ASSERT_EQ(latin1, input);
+}
+
+TEST(TestCase_utf8_to_utf16, round_trip)
+{
+	std::string input = "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80z";
+	std::u16string utf16(input.size(), u'\0');
+	auto result = unicode::utf8::utf8_to_utf16(input, utf16.data());
+	ASSERT_TRUE(result.ok());
+	utf16.resize(result.count);
+	ASSERT_EQ(utf16, u"aé€\U0001F600z");
+
+	std::string utf8(utf16.size() * 3, '\0');
+	result = unicode::utf8::utf16_to_utf8(utf16, utf8.data());
+	ASSERT_TRUE(result.ok());
+	utf8.resize(result.count);
+	ASSERT_EQ(utf8, input);
+}
+
+TEST(TestCase_utf16_to_utf8, unpaired_surrogate)
+{
+	std::u16string input = u"ab";
+	input += (char16_t)0xD800;
+	input += u"c";
+	std::string out(input.size() * 3, '\0');
+	auto result = unicode::utf8::utf16_to_utf8(input, out.data());
+	ASSERT_EQ(result.error, unicode::utf8::Error::Surrogate);
+	ASSERT_EQ(result.count, 2);
+}
+
+TEST(TestCase_utf8_to_utf32, round_trip)
+{
+	std::string input;
+	for (const auto& pair : UTF8_DATA_STRINGS)
+	{
+		input += pair.string;
+	}
+
+	std::u32string utf32(input.size(), U'\0');
+	auto result = unicode::utf8::utf8_to_utf32(input, utf32.data());
+	ASSERT_TRUE(result.ok());
+	utf32.resize(result.count);
+
+	std::string utf8(utf32.size() * 4, '\0');
+	result = unicode::utf8::utf32_to_utf8(utf32, utf8.data());
+	ASSERT_TRUE(result.ok());
+	utf8.resize(result.count);
+	ASSERT_EQ(utf8, input);
+}
+
+TEST(TestCase_utf32_to_utf8, errors)
+{
+	std::u32string input = U"a";
+	input += (char32_t)0x110000;
+	std::string out(input.size() * 4, '\0');
+	auto result = unicode::utf8::utf32_to_utf8(input, out.data());
+	ASSERT_EQ(result.error, unicode::utf8::Error::OutOfRange);
+	ASSERT_EQ(result.count, 1);
+
+	input = U"a";
+	input += (char32_t)0xDC00;
+	result = unicode::utf8::utf32_to_utf8(input, out.data());
+	ASSERT_EQ(result.error, unicode::utf8::Error::Surrogate);
+}